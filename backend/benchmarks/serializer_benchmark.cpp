@@ -0,0 +1,168 @@
+/**
+ * @file serializer_benchmark.cpp
+ * @brief Stream vs fixed-buffer benchmark for sonar point JSON serialization
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Measures per-point cost of the previous ostringstream serializer, the
+ * JsonSerializer entry point (fixed buffer plus one std::string) and the
+ * raw JsonSchema path into a caller buffer, verifies all three produce the
+ * same bytes, and counts heap allocations made by the fixed-buffer path.
+ */
+
+#include "utils/json_serializer.hpp"
+#include "utils/json_writer.hpp"
+#include "constants/message.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+
+namespace {
+    std::atomic<uint64_t> allocation_count{0};
+}
+
+// Count every global allocation so the fixed-buffer loop can prove it makes none
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace {
+    using siren::data::SonarDataPoint;
+    using siren::utils::JsonSchema;
+    namespace fields = siren::constants::message::json_fields;
+    namespace types = siren::constants::message::json_types;
+
+    constexpr uint32_t ITERATIONS = 1000000;
+
+    /// Representative points: narrow and wide values, sequence wrap region
+    const std::array<SonarDataPoint, 4> SAMPLE_POINTS = [] {
+        std::array<SonarDataPoint, 4> points;
+        points[0] = SonarDataPoint(93, 120, 100);
+        points[1] = SonarDataPoint(5, 2, 7);
+        points[2] = SonarDataPoint(175, 400, 55);
+        points[3] = SonarDataPoint(-1, -32768, 0);
+        for (size_t i = 0; i < points.size(); ++i) {
+            points[i].sequence = (i == 3) ? UINT32_MAX : static_cast<uint32_t>(12345 * (i + 1));
+        }
+        points[3].timestamp_us = UINT64_MAX;
+        return points;
+    }();
+
+    /// Previous implementation, kept as the reference for output and timing
+    template <typename T>
+    std::string legacyField(const char* name, const T& value, bool quoted = false) {
+        std::ostringstream oss;
+        oss << "\"" << name << "\":";
+        if (quoted) {
+            oss << "\"" << value << "\"";
+        } else {
+            oss << value;
+        }
+        return oss.str();
+    }
+
+    std::string legacySerialize(const SonarDataPoint& data) {
+        std::ostringstream oss;
+        oss << "{"
+            << legacyField(fields::TYPE, types::SONAR_DATA, true) << ","
+            << legacyField(fields::TIMESTAMP, data.timestamp_us) << ","
+            << legacyField(fields::ANGLE, data.angle) << ","
+            << legacyField(fields::DISTANCE, data.distance) << ","
+            << legacyField(fields::QUALITY, static_cast<int>(data.quality)) << ","
+            << legacyField(fields::SEQUENCE, data.sequence)
+            << "}";
+        return oss.str();
+    }
+
+    struct Measurement {
+        double nanos_per_point;
+        double allocations_per_point;
+    };
+
+    template <typename Serialize>
+    Measurement measure(Serialize serialize) {
+        uint64_t checksum = 0;
+        const uint64_t allocations_before = allocation_count.load(std::memory_order_relaxed);
+        const auto start = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < ITERATIONS; ++i) {
+            checksum += serialize(SAMPLE_POINTS[i % SAMPLE_POINTS.size()]);
+        }
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        const uint64_t allocations = allocation_count.load(std::memory_order_relaxed) - allocations_before;
+
+        // Keep the loop observable so it is not optimised away
+        if (checksum == 0) {
+            std::cout << "checksum: 0" << std::endl;
+        }
+
+        return Measurement{static_cast<double>(elapsed) / ITERATIONS,
+                           static_cast<double>(allocations) / ITERATIONS};
+    }
+
+    bool serializersAgree() {
+        for (const auto& point : SAMPLE_POINTS) {
+            const std::string legacy = legacySerialize(point);
+            const std::string current = siren::utils::JsonSerializer::serialize(point);
+
+            std::array<char, JsonSchema<SonarDataPoint>::MAX_SIZE> buffer;
+            const size_t size = siren::utils::serializeJson(point, buffer.data(), buffer.size());
+            const std::string fixed(buffer.data(), size);
+
+            if (size == 0 || legacy != current || legacy != fixed) {
+                std::cout << "Mismatch:\n  legacy: " << legacy << "\n  current: " << current
+                          << "\n  fixed:  " << fixed << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    if (!serializersAgree()) {
+        return 1;
+    }
+
+    const Measurement legacy = measure([](const SonarDataPoint& point) {
+        return legacySerialize(point).size();
+    });
+    const Measurement current = measure([](const SonarDataPoint& point) {
+        return siren::utils::JsonSerializer::serialize(point).size();
+    });
+    std::array<char, JsonSchema<SonarDataPoint>::MAX_SIZE> buffer;
+    const Measurement fixed = measure([&buffer](const SonarDataPoint& point) {
+        return siren::utils::serializeJson(point, buffer.data(), buffer.size());
+    });
+
+    std::cout << "\n=== Sonar point JSON serializer benchmark (" << ITERATIONS << " points) ===" << std::endl;
+    std::cout << "ostringstream:  " << legacy.nanos_per_point << " ns/point, "
+              << legacy.allocations_per_point << " allocs/point" << std::endl;
+    std::cout << "JsonSerializer: " << current.nanos_per_point << " ns/point, "
+              << current.allocations_per_point << " allocs/point" << std::endl;
+    std::cout << "fixed buffer:   " << fixed.nanos_per_point << " ns/point, "
+              << fixed.allocations_per_point << " allocs/point" << std::endl;
+    std::cout << "speedup:        " << (legacy.nanos_per_point / fixed.nanos_per_point) << "x" << std::endl;
+
+    return fixed.allocations_per_point == 0.0 ? 0 : 1;
+}
@@ -48,6 +48,61 @@ namespace serial {
 
     /// Command terminator character for Arduino communication
     constexpr const char* COMMAND_TERMINATOR = "\n";
+
+    /// Negotiate the binary framed protocol after the first valid ASCII line
+    constexpr bool BINARY_PROTOCOL_ENABLED = true;
+
+    /// Baud rate used once the binary protocol has been acknowledged
+    constexpr uint32_t BINARY_BAUD_RATE = 115200;
+
+    /// Handshake command requesting the binary protocol (must match firmware)
+    constexpr const char* BINARY_MODE_COMMAND = "PROTO BIN";
+
+    /// Firmware acknowledgement line, sent in ASCII before switching baud rate
+    constexpr const char* BINARY_MODE_ACK = "ACK PROTO BIN";
+}
+
+/// Raw serial capture file format (append-only, native little-endian)
+/// File: MAGIC[8] VERSION u32 RESERVED u32, then records of
+/// monotonic timestamp u64 (ns), length u32, length bytes of received data
+namespace capture {
+    /// File magic identifying a SIREN serial capture
+    constexpr const char* MAGIC = "SIRENCAP";
+    constexpr size_t MAGIC_SIZE = 8;
+
+    /// Capture format version
+    constexpr uint32_t VERSION = 1;
+
+    /// File header size in bytes
+    constexpr size_t FILE_HEADER_SIZE = MAGIC_SIZE + sizeof(uint32_t) + sizeof(uint32_t);
+
+    /// Record header size in bytes
+    constexpr size_t RECORD_HEADER_SIZE = sizeof(uint64_t) + sizeof(uint32_t);
+
+    /// Default replay speed multiplier (1 = real time, 0 = as fast as possible)
+    constexpr double DEFAULT_REPLAY_SPEED = 1.0;
+
+    /// Chunks fed per event loop turn in as-fast-as-possible replay
+    constexpr size_t REPLAY_BATCH_CHUNKS = 64;
+}
+
+/// Built-in synthetic sonar source (stress testing without hardware)
+namespace synthetic {
+    /// Accepted sample rates (hardware tops out near 17 samples/s)
+    constexpr double MIN_RATE_HZ = 10.0;
+    constexpr double MAX_RATE_HZ = 1000000.0;
+
+    /// Generation tick: samples due since the last tick are emitted together
+    constexpr uint32_t TICK_INTERVAL_US = 1000;
+
+    /// Samples further behind than this are skipped, not emitted late (consumers saturated)
+    constexpr uint64_t MAX_LAG_US = 100000;
+
+    /// Gaussian distance noise standard deviation
+    constexpr double NOISE_STDDEV_CM = 1.5;
+
+    /// Noise generator seed (fixed, so runs are repeatable)
+    constexpr uint32_t NOISE_SEED = 1;
 }
 
 /// WebSocket server configuration
@@ -90,4 +145,101 @@ namespace json {
     constexpr const char* FIELD_PAYLOAD = "payload";
 }
 
+/// Per-client outbound queue limits and backpressure policies
+namespace backpressure {
+    /// Hard limit on serialized bytes queued for one client
+    constexpr size_t MAX_QUEUED_BYTES = 256 * 1024;
+
+    /// Warning threshold (80% of max)
+    constexpr size_t WARNING_QUEUED_BYTES = MAX_QUEUED_BYTES * 8 / 10;
+
+    /// Decimation: sweep interval doubles above high water, halves below low water
+    constexpr size_t DECIMATION_HIGH_WATER_BYTES = MAX_QUEUED_BYTES / 2;
+    constexpr size_t DECIMATION_LOW_WATER_BYTES = MAX_QUEUED_BYTES / 8;
+    constexpr uint32_t MAX_DECIMATION_FACTOR = 8;
+
+    /// Conflation bins: one per degree over the full servo range
+    constexpr size_t ANGLE_BIN_COUNT = 181;
+
+    /// Upgrade request query parameter selecting the policy: ws://host:port/?backpressure=conflate
+    constexpr const char* POLICY_PARAMETER = "backpressure";
+
+    /// Policy parameter values
+    constexpr const char* POLICY_DISCONNECT = "disconnect";
+    constexpr const char* POLICY_DROP_OLDEST = "drop-oldest";
+    constexpr const char* POLICY_CONFLATE = "conflate";
+    constexpr const char* POLICY_DECIMATE = "decimate";
+}
+
+/// Sonar broadcast batching (per-batch delivery clients)
+namespace batching {
+    /// Flush when a batch holds this many points (one full sweep)
+    constexpr size_t DEFAULT_MAX_POINTS = 86;
+
+    /// Flush when the oldest point in a batch is this old (bounds display latency)
+    constexpr uint32_t DEFAULT_MAX_DELAY_US = 100000;
+
+    /// Upgrade request query parameter selecting sonar delivery: ws://host:port/?delivery=batch
+    constexpr const char* DELIVERY_PARAMETER = "delivery";
+
+    /// Delivery parameter values (per-point is the default)
+    constexpr const char* DELIVERY_POINT = "point";
+    constexpr const char* DELIVERY_BATCH = "batch";
+}
+
+/// Latest-scan table sent to clients on connect
+namespace scan_snapshot {
+    /// Readings older than this are left out of the snapshot (sensor stopped or moved on)
+    constexpr uint64_t MAX_AGE_US = 10000000;
+}
+
+/// Resume-on-reconnect: replay of recently broadcast sonar samples
+namespace resume {
+    /// Samples held for replay (fixed ring, covers WINDOW_US at up to ~400 samples/s)
+    constexpr size_t RING_CAPACITY = 4096;
+
+    /// Samples older than this are not replayed; the client is re-synced with the scan snapshot
+    constexpr uint64_t WINDOW_US = 10000000;
+
+    /// Longer gaps are re-synced with the snapshot (keeps one replay frame within MAX_QUEUED_BYTES)
+    constexpr size_t MAX_REPLAY_POINTS = 2048;
+
+    /// Upgrade request query parameter carrying the last sequence received: ws://host:port/?last_seq=N
+    constexpr const char* LAST_SEQ_PARAMETER = "last_seq";
+}
+
+/// Delta-encoded sonar delivery (only angles whose reading changed)
+namespace delta {
+    /// Send a point when its distance moved more than this since the last one sent at its angle
+    constexpr int16_t DEFAULT_THRESHOLD_CM = 2;
+
+    /// Resend an unchanged angle after this long (rolling keyframe, bounds staleness after loss)
+    constexpr uint32_t DEFAULT_KEYFRAME_INTERVAL_US = 5000000;
+
+    /// Upgrade request query parameter selecting sonar encoding: ws://host:port/?encoding=delta
+    constexpr const char* ENCODING_PARAMETER = "encoding";
+
+    /// Encoding parameter values (full is the default)
+    constexpr const char* ENCODING_FULL = "full";
+    constexpr const char* ENCODING_DELTA = "delta";
+}
+
+/// Client subscription filters (subscribe control messages)
+namespace subscription {
+    /// Larger control messages are rejected unparsed
+    constexpr size_t MAX_MESSAGE_BYTES = 4096;
+
+    /// Sector resolution: one bin per degree, shared with conflation
+    constexpr size_t ANGLE_BIN_COUNT = backpressure::ANGLE_BIN_COUNT;
+
+    /// Upper bound on sectors in one subscription
+    constexpr size_t MAX_SECTORS = 32;
+
+    /// Highest accepted per-topic update rate (0 = unlimited)
+    constexpr uint32_t MAX_RATE_HZ = 1000;
+
+    /// Status sent back when a subscription is applied
+    constexpr const char* STATUS_SUBSCRIBED = "subscribed";
+}
+
 } } } // namespace siren::constants::communication
\ No newline at end of file
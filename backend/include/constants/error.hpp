@@ -54,6 +54,9 @@ namespace codes {
 
     /// System-level error base code
     constexpr uint32_t SYSTEM_ERROR_BASE = 4000;
+
+    /// Client sent a malformed subscribe message (reported to that client)
+    constexpr uint32_t INVALID_SUBSCRIPTION = NETWORK_ERROR_BASE + 1;
 }
 
 /// Logging configuration
@@ -69,6 +72,15 @@ namespace logging {
 
     /// Maximum log line length
     constexpr uint16_t MAX_LOG_LINE_LENGTH = 2048;
+
+    /// Records per thread in the asynchronous logger ring (power of two)
+    constexpr size_t RING_CAPACITY_RECORDS = 512;
+
+    /// Fixed text capacity of one asynchronous log record (longer messages are truncated)
+    constexpr size_t RECORD_TEXT_SIZE = 224;
+
+    /// Background writer idle poll interval
+    constexpr auto WRITER_POLL_INTERVAL = std::chrono::milliseconds(5);
 }
 
 } } } // namespace siren::constants::error
\ No newline at end of file
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 #include <chrono>
 
 namespace siren { namespace constants { namespace hardware {
@@ -28,7 +29,45 @@ namespace arduino {
     constexpr auto MAX_RESPONSE_TIME = std::chrono::milliseconds(100);
 
     /// Data format regex pattern for Arduino protocol parsing
-    constexpr const char* DATA_FORMAT_REGEX = R"(Angle:\s*(\d+)\s*-\s*Distance:\s*(\d+))";
+    /// Optional trailer: " - Temp: T - Humidity: H[ - SoundSpeed: S]" (groups 3-5)
+    constexpr const char* DATA_FORMAT_REGEX =
+        R"(Angle:\s*(\d+)\s*-\s*Distance:\s*(\d+))"
+        R"((?:\s*-\s*Temp:\s*(-?\d+(?:\.\d+)?)\s*-\s*Humidity:\s*(-?\d+(?:\.\d+)?))"
+        R"((?:\s*-\s*SoundSpeed:\s*(-?\d+(?:\.\d+)?))?)?)";
+
+    /// Field tokens for the hand-written protocol scanner (must match DATA_FORMAT_REGEX)
+    constexpr const char* ANGLE_TOKEN = "Angle:";
+    constexpr const char* DISTANCE_TOKEN = "Distance:";
+    constexpr const char* TEMPERATURE_TOKEN = "Temp:";
+    constexpr const char* HUMIDITY_TOKEN = "Humidity:";
+    constexpr const char* SOUND_SPEED_TOKEN = "SoundSpeed:";
+    constexpr char FIELD_SEPARATOR = '-';
+
+    /// Binary sample frame: COBS-encoded payload + CRC16-CCITT, 0x00 delimited
+    /// Payload (little-endian): version u8, flags u8, angle u8, distance u16,
+    /// firmware timestamp u32 [, temperature i16 x10, humidity u16 x10, sound speed u16 x1e5]
+    namespace binary_frame {
+        constexpr uint8_t DELIMITER = 0x00;
+        constexpr uint8_t VERSION = 1;
+        constexpr uint8_t FLAG_ENVIRONMENT = 0x01;
+
+        constexpr size_t BASE_PAYLOAD_SIZE = 9;
+        constexpr size_t ENVIRONMENT_PAYLOAD_SIZE = 6;
+        constexpr size_t CRC_SIZE = 2;
+        constexpr size_t MAX_PAYLOAD_SIZE = BASE_PAYLOAD_SIZE + ENVIRONMENT_PAYLOAD_SIZE;
+
+        /// COBS adds one overhead byte per 254 bytes of input
+        constexpr size_t MAX_ENCODED_SIZE = MAX_PAYLOAD_SIZE + CRC_SIZE + 1;
+
+        /// CRC-16/CCITT-FALSE parameters
+        constexpr uint16_t CRC_POLYNOMIAL = 0x1021;
+        constexpr uint16_t CRC_INITIAL = 0xFFFF;
+
+        /// Fixed-point scales for environmental fields
+        constexpr float TEMPERATURE_SCALE = 10.0f;
+        constexpr float HUMIDITY_SCALE = 10.0f;
+        constexpr float SOUND_SPEED_SCALE = 100000.0f;
+    }
 }
 
 /// SG90 Servo Motor specifications from datasheet
@@ -70,6 +109,21 @@ namespace sensor {
     constexpr auto MEASUREMENT_TIMEOUT = std::chrono::microseconds(30000);
 }
 
+/// DHT11 Temperature/Humidity Sensor specifications from datasheet
+namespace environment {
+    /// Minimum measurable temperature in degrees Celsius
+    constexpr float MIN_TEMPERATURE_C = 0.0f;
+
+    /// Maximum measurable temperature in degrees Celsius
+    constexpr float MAX_TEMPERATURE_C = 50.0f;
+
+    /// Minimum measurable relative humidity in percent
+    constexpr float MIN_HUMIDITY_PERCENT = 20.0f;
+
+    /// Maximum measurable relative humidity in percent
+    constexpr float MAX_HUMIDITY_PERCENT = 90.0f;
+}
+
 /// Cross-platform serial port detection
 namespace platform {
     /// Platform detection flags (MISRA C++ compliant)
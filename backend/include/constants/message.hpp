@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <chrono>
 
@@ -26,12 +27,52 @@ namespace json_fields {
     constexpr const char* ANGLE = "angle";
     constexpr const char* DISTANCE = "distance";
     constexpr const char* QUALITY = "quality";
+    constexpr const char* SEQUENCE = "seq";
     constexpr const char* MESSAGES_PER_SECOND = "messages_per_second";
     constexpr const char* AVG_LATENCY_US = "avg_latency_us";
     constexpr const char* MAX_LATENCY_US = "max_latency_us";
     constexpr const char* MEMORY_USAGE_BYTES = "memory_usage_bytes";
     constexpr const char* ACTIVE_CONNECTIONS = "active_connections";
     constexpr const char* SERIAL_STATUS = "serial_status";
+    constexpr const char* TEMPERATURE_C = "temperature_c";
+    constexpr const char* HUMIDITY_PERCENT = "humidity_percent";
+    constexpr const char* SOUND_SPEED_CM_PER_US = "sound_speed_cm_per_us";
+
+    /// Sonar batch fields
+    constexpr const char* SWEEP = "sweep";
+    constexpr const char* SWEEP_COMPLETE = "sweep_complete";
+    constexpr const char* POINTS = "points";
+
+    /// Latency percentile objects in performance metrics
+    constexpr const char* PROCESSING_LATENCY = "processing_latency";
+    constexpr const char* SERIAL_TO_BROADCAST_LATENCY = "serial_to_broadcast_latency";
+    constexpr const char* SESSION_WRITE_LATENCY = "session_write_latency";
+    constexpr const char* P50_US = "p50_us";
+    constexpr const char* P99_US = "p99_us";
+    constexpr const char* P999_US = "p999_us";
+    constexpr const char* MAX_US = "max_us";
+    constexpr const char* SAMPLES = "samples";
+
+    /// Client queue object in performance metrics
+    constexpr const char* CLIENT_QUEUES = "client_queues";
+    constexpr const char* BYTES_QUEUED = "bytes_queued";
+    constexpr const char* PEAK_BYTES_QUEUED = "peak_bytes_queued";
+    constexpr const char* MESSAGES_DROPPED = "messages_dropped";
+    constexpr const char* MESSAGES_CONFLATED = "messages_conflated";
+    constexpr const char* MESSAGES_DECIMATED = "messages_decimated";
+    constexpr const char* DECIMATION_FACTOR = "decimation_factor";
+
+    /// Per-client queue list in performance metrics
+    constexpr const char* SESSION_QUEUES = "session_queues";
+    constexpr const char* ENDPOINT = "endpoint";
+    constexpr const char* POLICY = "policy";
+
+    /// Subscription control message fields (client -> server)
+    constexpr const char* SECTORS = "sectors";
+    constexpr const char* MIN_DISTANCE_CM = "min_distance_cm";
+    constexpr const char* MAX_DISTANCE_CM = "max_distance_cm";
+    constexpr const char* TYPES = "types";
+    constexpr const char* MAX_RATE_HZ = "max_rate_hz";
 
     /// Error handling and reporting fields
     constexpr const char* SEVERITY = "severity";
@@ -43,10 +84,53 @@ namespace json_fields {
 /// JSON message types - Single Source of Truth for message type identification
 namespace json_types {
     constexpr const char* SONAR_DATA = "sonar_data";
+    constexpr const char* SONAR_BATCH = "sonar_batch";
+    constexpr const char* ENVIRONMENT_DATA = "environment_data";
     constexpr const char* PERFORMANCE_METRICS = "performance_metrics";
     constexpr const char* STATUS_UPDATE = "status_update";
     constexpr const char* ERROR_REPORT = "error_report";
     constexpr const char* KEEPALIVE = "keepalive";
+    constexpr const char* SUBSCRIBE = "subscribe";
+    constexpr const char* SCAN_SNAPSHOT = "scan_snapshot";
+    constexpr const char* SONAR_REPLAY = "sonar_replay";
+}
+
+/// Binary WebSocket subprotocol (negotiated via Sec-WebSocket-Protocol)
+///
+/// Frames are fixed-layout, little-endian, unpadded. Byte 0 is the frame
+/// type. Messages without a binary layout (metrics, status) stay JSON text
+/// frames on the same connection.
+namespace binary_protocol {
+    /// Subprotocol token; clients not offering it get JSON text frames
+    constexpr const char* SUBPROTOCOL = "siren.bin.v2";
+
+    /// Frame type identifiers (byte 0)
+    constexpr uint8_t FRAME_SONAR_DATA = 0x01;
+    constexpr uint8_t FRAME_ENVIRONMENT_DATA = 0x02;
+    constexpr uint8_t FRAME_SONAR_BATCH = 0x03;
+    constexpr uint8_t FRAME_SCAN_SNAPSHOT = 0x04;
+    constexpr uint8_t FRAME_SONAR_REPLAY = 0x05;
+
+    /// Sonar frame: type u8 | quality u8 | angle i16 | distance i16 | timestamp_us u64 | sequence u32
+    constexpr size_t SONAR_FRAME_SIZE = 18;
+
+    /// Environment frame: type u8 | temperature_c f32 | humidity_percent f32 |
+    /// sound_speed_cm_per_us f32 | timestamp_us u64
+    constexpr size_t ENVIRONMENT_FRAME_SIZE = 21;
+
+    /// Sonar batch frame: type u8 | flags u8 | point_count u16 | sweep_count u32,
+    /// then point_count records laid out as a sonar frame without its type byte
+    constexpr size_t SONAR_BATCH_HEADER_SIZE = 8;
+    constexpr size_t SONAR_BATCH_RECORD_SIZE = SONAR_FRAME_SIZE - 1;
+
+    /// Batch flags (byte 1)
+    constexpr uint8_t FLAG_SWEEP_COMPLETE = 0x01;
+
+    /// Scan snapshot frame: sonar batch layout with FRAME_SCAN_SNAPSHOT type,
+    /// flags and sweep_count 0, records in ascending angle order
+
+    /// Sonar replay frame: sonar batch layout with FRAME_SONAR_REPLAY type,
+    /// flags and sweep_count 0, records in sequence order
 }
 
 /// Version and build information
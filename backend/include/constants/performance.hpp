@@ -67,13 +67,25 @@ namespace buffers {
     constexpr uint32_t METRICS_HISTORY_SIZE = 3600;
 }
 
+/// Log-linear latency histograms (HDR-histogram style)
+namespace histogram {
+    /// Sub-buckets per power of two = 2^SUB_BUCKET_BITS (relative error <= 1/32 ~ 3%)
+    constexpr uint32_t SUB_BUCKET_BITS = 5;
+
+    /// Largest trackable value = 2^MAX_VALUE_BITS - 1 microseconds (~67 s), larger values saturate
+    constexpr uint32_t MAX_VALUE_BITS = 26;
+
+    /// Sliding percentile window length in monitoring intervals (10 s at 1 Hz)
+    constexpr uint32_t WINDOW_INTERVALS = 10;
+}
+
 /// System optimization constants
 namespace optimization {
     /// Moving average calculation factor (exponential moving average)
     constexpr double MOVING_AVERAGE_ALPHA = 0.1;
 
-    /// CPU spin prevention divisor
-    constexpr uint32_t SPIN_PREVENTION_DIVISOR = 10;
+    /// Parser timing is sampled on one message in this many (clock reads dominate a scanned line)
+    constexpr uint64_t PARSE_TIMING_SAMPLE_INTERVAL = 64;
 
     /// Health check timeout threshold
     constexpr uint32_t HEALTH_CHECK_TIMEOUT_SEC = 5;
@@ -11,19 +11,67 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <boost/asio.hpp>
 
 #include "data/sonar_types.hpp"
 #include "core/system_state_manager.hpp"
 #include "core/performance_monitor.hpp"
+#include "core/sweep_batcher.hpp"
 #include "serial/serial_interface.hpp"
+#include "serial/synthetic_source.hpp"
 #include "websocket/server.hpp"
+#include "constants/communication.hpp"
+#include "constants/performance.hpp"
 
 namespace siren::core {
 
+/**
+ * @brief Controller configuration (from the command line)
+ */
+struct ControllerOptions {
+    /// Serial device to use, empty = auto-detect Arduino
+    std::string serial_port;
+
+    /// Append raw received serial data to this capture file, empty = off
+    std::string capture_path;
+
+    /// Replay this capture file instead of opening a serial device, empty = off
+    std::string replay_path;
+
+    /// Replay time scale: 1 = real time, N = N x faster, 0 = as fast as possible
+    double replay_speed;
+
+    /// Generate a synthetic scene at this many samples/s instead of reading serial, 0 = off
+    double synthetic_rate_hz;
+
+    /// Threads running the shared I/O context (handlers are serialized per component by strands)
+    size_t io_threads;
+
+    /// Per-batch delivery: flush after this many points
+    size_t batch_max_points;
+
+    /// Per-batch delivery: flush when the oldest point is this old (microseconds)
+    uint32_t batch_max_delay_us;
+
+    /// Delta encoding: send a point when its distance moved more than this (centimeters)
+    int16_t delta_threshold_cm;
+
+    /// Delta encoding: resend an unchanged angle after this long (microseconds, 0 = never)
+    uint32_t delta_keyframe_interval_us;
+
+    ControllerOptions()
+        : replay_speed(constants::communication::capture::DEFAULT_REPLAY_SPEED)
+        , synthetic_rate_hz(0.0)
+        , io_threads(constants::performance::timing::THREAD_POOL_SIZE)
+        , batch_max_points(constants::communication::batching::DEFAULT_MAX_POINTS)
+        , batch_max_delay_us(constants::communication::batching::DEFAULT_MAX_DELAY_US)
+        , delta_threshold_cm(constants::communication::delta::DEFAULT_THRESHOLD_CM)
+        , delta_keyframe_interval_us(constants::communication::delta::DEFAULT_KEYFRAME_INTERVAL_US) {}
+};
+
 // Forward declarations
 class DataProcessor;
-class Logger;
 
 /**
  * @brief Master controller with single responsibility: coordination
@@ -35,8 +83,9 @@ class MasterController {
 public:
     /**
      * @brief Construct master controller
+     * @param options Serial data source selection
      */
-    explicit MasterController();
+    explicit MasterController(const ControllerOptions& options = ControllerOptions{});
 
     /**
      * @brief Destructor - ensures clean shutdown
@@ -92,10 +141,11 @@ public:
     bool isHealthy() const noexcept;
 
     /**
-     * @brief Run the main event loop (blocking)
+     * @brief Run the I/O context on the configured thread pool (blocking)
      *
-     * This is the main entry point for system operation.
-     * Runs until stop() is called or critical error occurs.
+     * This is the main entry point for system operation. The calling thread
+     * joins the pool; handlers are dispatched as soon as their events arrive.
+     * Runs until stop() is called, SIGINT/SIGTERM or a critical error occurs.
      */
     void run();
 
@@ -108,6 +158,7 @@ private:
     // Core I/O components
     std::unique_ptr<boost::asio::io_context> io_context_;
     std::unique_ptr<boost::asio::steady_timer> heartbeat_timer_;
+    std::unique_ptr<boost::asio::signal_set> shutdown_signals_;
 
     // Specialized responsibility components
     std::unique_ptr<SystemStateManager> state_manager_;
@@ -115,9 +166,16 @@ private:
 
     // Subsystem components
     std::unique_ptr<serial::SerialInterface> serial_interface_;
-    std::unique_ptr<websocket::WebSocketServer> websocket_server_;
+    std::unique_ptr<serial::SyntheticSource> synthetic_source_;
+    std::shared_ptr<websocket::WebSocketServer> websocket_server_;  // Shared: sessions hold a weak reference
+    std::unique_ptr<SweepBatcher> sweep_batcher_;
     // std::unique_ptr<DataProcessor> data_processor_;      // Will be implemented later
-    // std::unique_ptr<Logger> logger_;                     // Will be implemented later
+
+    // Serial data source selection (device, capture, replay)
+    ControllerOptions options_;
+
+    // Last sequence number assigned to a broadcast sample (0 is never assigned)
+    std::atomic<uint32_t> sample_sequence_;
 
     // Shutdown coordination
     std::atomic<bool> shutdown_requested_;
@@ -132,6 +190,11 @@ private:
      */
     bool initializeSubsystems();
 
+    /**
+     * @brief Start the configured data source (synthetic, replay, explicit port or auto-detect)
+     */
+    void startSerialSource();
+
     /**
      * @brief Set up periodic tasks (heartbeat)
      */
@@ -142,6 +205,11 @@ private:
      */
     void onHeartbeat(const boost::system::error_code& error);
 
+    /**
+     * @brief Run the I/O context on the calling thread until it is stopped
+     */
+    void runEventLoop();
+
     // handleSystemError removed - now using centralized ErrorHandler utility
 
     /**
@@ -161,10 +229,15 @@ private:
     void onMetricsUpdate(const data::PerformanceMetrics& metrics);
 
     /**
-     * @brief Sonar data callback from SerialInterface
+     * @brief Sonar data callback from SerialInterface or SyntheticSource
      */
     void onSonarData(const data::SonarDataPoint& sonar_data);
 
+    /**
+     * @brief Environmental data callback from SerialInterface (only on change)
+     */
+    void onEnvironmentData(const data::EnvironmentalData& environment);
+
     /**
      * @brief Serial error callback from SerialInterface
      */
@@ -12,8 +12,10 @@
 #include <chrono>
 #include <mutex>
 #include <functional>
+#include <vector>
 #include "data/sonar_types.hpp"
 #include "utils/statistics_calculator.hpp"
+#include "utils/latency_tracker.hpp"
 
 namespace siren::core {
 
@@ -44,10 +46,13 @@ public:
     void stop();
 
     /**
-     * @brief Update metrics with new measurements
-     * @param processing_time_us Processing time in microseconds
+     * @brief Close the current monitoring interval of every latency channel
+     *
+     * Drains LatencyTracker into the sliding windows and refreshes the
+     * percentile fields of the metrics. Call once per monitoring interval.
+     * @return Handlers above MAX_LATENCY_US during the interval
      */
-    void recordProcessingTime(uint64_t processing_time_us);
+    uint64_t updateLatencyWindows();
 
     /**
      * @brief Record message processing
@@ -60,6 +65,14 @@ public:
      */
     void updateActiveConnections(uint16_t count);
 
+    /**
+     * @brief Update client queue statistics
+     * @param statistics Byte accounting and backpressure counters over all clients
+     * @param sessions Queue statistics of each active client
+     */
+    void updateClientQueues(const data::QueueStatistics& statistics,
+                            std::vector<data::SessionQueueStatistics> sessions);
+
     /**
      * @brief Update serial status
      * @param status Current serial connection status
@@ -105,6 +118,11 @@ private:
     utils::UInt32StatsCalculator throughput_calculator_;
     utils::UInt64StatsCalculator memory_calculator_;
 
+    // Tail latency over sliding windows, one per LatencyChannel
+    utils::SlidingLatencyWindow processing_window_;
+    utils::SlidingLatencyWindow serial_to_broadcast_window_;
+    utils::SlidingLatencyWindow session_write_window_;
+
     // Callback
     MetricsCallback metrics_callback_;
 
@@ -0,0 +1,96 @@
+/**
+ * @file sweep_batcher.hpp
+ * @brief Sonar point batching stage between the serial source and broadcasting
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Single responsibility: Group consecutive sonar points into batches.
+ *
+ * A batch is flushed when it reaches max points, when its oldest point
+ * reaches max delay, or at a sweep boundary (servo direction reversal).
+ * Per-batch clients then receive one frame per batch instead of one per point.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <boost/asio.hpp>
+#include "data/sonar_types.hpp"
+#include "utils/sweep_tracker.hpp"
+
+namespace siren::core {
+
+/**
+ * @brief Sweep-aware sonar point batcher
+ *
+ * addPoint() may be called from any thread; batching state lives on the
+ * batcher's own strand, so batches are emitted in acquisition order.
+ */
+class SweepBatcher {
+public:
+    /// Batch ready callback type (called on the batcher strand)
+    using BatchCallback = std::function<void(const data::SonarBatch&)>;
+
+    /**
+     * @brief Constructor
+     * @param io_context I/O context running the flush timer
+     * @param max_points Flush when a batch holds this many points (minimum 1)
+     * @param max_delay Flush when the oldest point in a batch is this old
+     */
+    SweepBatcher(boost::asio::io_context& io_context,
+                 size_t max_points,
+                 std::chrono::microseconds max_delay);
+
+    // Non-copyable, non-movable
+    SweepBatcher(const SweepBatcher&) = delete;
+    SweepBatcher& operator=(const SweepBatcher&) = delete;
+    SweepBatcher(SweepBatcher&&) = delete;
+    SweepBatcher& operator=(SweepBatcher&&) = delete;
+
+    /**
+     * @brief Set callback for completed batches
+     * @param callback Function to call with each flushed batch
+     */
+    void setBatchCallback(BatchCallback callback);
+
+    /**
+     * @brief Add a sonar point to the current batch
+     * @param point Sonar data point in acquisition order
+     */
+    void addPoint(const data::SonarDataPoint& point);
+
+private:
+    boost::asio::strand<boost::asio::io_context::executor_type> strand_;
+    boost::asio::steady_timer flush_timer_;
+
+    // Flush policy
+    size_t max_points_;
+    std::chrono::microseconds max_delay_;
+
+    // Batching state (strand only)
+    data::SonarBatch pending_;
+    utils::SweepTracker sweep_tracker_;
+    uint64_t batch_generation_;  ///< Incremented per flush; stale timers compare against it
+
+    BatchCallback batch_callback_;
+
+    /**
+     * @brief Batch a point (runs on strand)
+     */
+    void onPoint(const data::SonarDataPoint& point);
+
+    /**
+     * @brief Max delay expired for the batch started at the given generation
+     */
+    void onFlushTimer(const boost::system::error_code& error, uint64_t generation);
+
+    /**
+     * @brief Emit the pending batch and start a new one
+     * @param sweep_complete True if the batch ends its sweep
+     */
+    void flush(bool sweep_complete);
+};
+
+} // namespace siren::core
@@ -12,6 +12,8 @@
 
 #include <chrono>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 namespace siren {
 namespace data {
@@ -34,21 +36,79 @@ struct SonarDataPoint {
     /// Quality indicator (0-100, higher is better)
     uint8_t quality;
 
+    /// Broadcast sequence number, assigned once per sample by the controller (0 = unassigned, wraps)
+    uint32_t sequence;
+
+    /// Firmware micros() at transmission (binary frames only, 0 = unknown; wraps every ~71 min)
+    uint32_t device_timestamp_us;
+
     /// Default constructor
     SonarDataPoint()
-        : angle(0), distance(0), quality(0) {
+        : angle(0), distance(0), quality(0), sequence(0), device_timestamp_us(0) {
+        auto now = std::chrono::steady_clock::now();
+        timestamp_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            now.time_since_epoch()).count();
+    }
+
+    /// Quality of a reading that passed hardware validation
+    static constexpr uint8_t FULL_QUALITY = 100;
+
+    /// Constructor with values
+    SonarDataPoint(int16_t a, int16_t d, uint8_t q = FULL_QUALITY)
+        : angle(a), distance(d), quality(q), sequence(0), device_timestamp_us(0) {
+        auto now = std::chrono::steady_clock::now();
+        timestamp_us = std::chrono::duration_cast<std::chrono::microseconds>(
+            now.time_since_epoch()).count();
+    }
+
+    /// Constructor with values and a receipt time already taken (no clock read)
+    SonarDataPoint(int16_t a, int16_t d, uint8_t q, uint64_t receipt_timestamp_us)
+        : angle(a), distance(d), timestamp_us(receipt_timestamp_us), quality(q)
+        , sequence(0), device_timestamp_us(0) {}
+};
+
+/// Environmental calibration sample reported by the firmware alongside sonar data
+struct EnvironmentalData {
+    /// Ambient temperature in degrees Celsius (DHT11)
+    float temperature_c;
+
+    /// Relative humidity in percent (DHT11)
+    float humidity_percent;
+
+    /// Calibrated speed of sound in cm/µs (0 if not reported)
+    float sound_speed_cm_per_us;
+
+    /// Timestamp when the sample was received (microseconds since epoch)
+    uint64_t timestamp_us;
+
+    /// Default constructor
+    EnvironmentalData()
+        : temperature_c(0.0f), humidity_percent(0.0f), sound_speed_cm_per_us(0.0f) {
         auto now = std::chrono::steady_clock::now();
         timestamp_us = std::chrono::duration_cast<std::chrono::microseconds>(
             now.time_since_epoch()).count();
     }
 
     /// Constructor with values
-    SonarDataPoint(int16_t a, int16_t d, uint8_t q = 100)
-        : angle(a), distance(d), quality(q) {
+    EnvironmentalData(float temperature, float humidity, float sound_speed)
+        : temperature_c(temperature), humidity_percent(humidity)
+        , sound_speed_cm_per_us(sound_speed) {
         auto now = std::chrono::steady_clock::now();
         timestamp_us = std::chrono::duration_cast<std::chrono::microseconds>(
             now.time_since_epoch()).count();
     }
+
+    /// Constructor with values and a receipt time already taken (no clock read)
+    EnvironmentalData(float temperature, float humidity, float sound_speed, uint64_t receipt_timestamp_us)
+        : temperature_c(temperature), humidity_percent(humidity)
+        , sound_speed_cm_per_us(sound_speed), timestamp_us(receipt_timestamp_us) {}
+
+    /// Same physical reading (timestamp ignored)
+    bool sameReadingAs(const EnvironmentalData& other) const noexcept {
+        return temperature_c == other.temperature_c &&
+               humidity_percent == other.humidity_percent &&
+               sound_speed_cm_per_us == other.sound_speed_cm_per_us;
+    }
 };
 
 /// Sweep direction for sonar operation
@@ -84,6 +144,44 @@ struct SweepState {
         , last_movement(std::chrono::steady_clock::now()) {}
 };
 
+/// Consecutive sonar points delivered as one WebSocket frame
+struct SonarBatch {
+    /// Points in acquisition order
+    std::vector<SonarDataPoint> points;
+
+    /// Sweep the points belong to (SweepState::sweep_count when batched)
+    uint32_t sweep_count;
+
+    /// True if this batch ends its sweep (flushed on direction reversal)
+    bool sweep_complete;
+
+    /// Default constructor
+    SonarBatch()
+        : points()
+        , sweep_count(0)
+        , sweep_complete(false) {}
+};
+
+/// Latest reading per angle, sent to clients when they connect
+struct ScanSnapshot {
+    /// One point per angle that has a recent reading, in ascending angle order
+    std::vector<SonarDataPoint> points;
+
+    /// Default constructor
+    ScanSnapshot()
+        : points() {}
+};
+
+/// Samples a reconnecting client missed, sent instead of the scan snapshot
+struct SonarReplay {
+    /// Points after the client's last sequence number, in sequence order
+    std::vector<SonarDataPoint> points;
+
+    /// Default constructor
+    SonarReplay()
+        : points() {}
+};
+
 // ============================================================================
 // SERIAL COMMUNICATION TYPES
 // ============================================================================
@@ -173,6 +271,66 @@ struct WebSocketMessage {
 // SYSTEM PERFORMANCE TYPES
 // ============================================================================
 
+/// Latency distribution summary over a sliding window
+struct LatencyPercentiles {
+    /// Median in microseconds
+    uint32_t p50_us;
+
+    /// 99th percentile in microseconds
+    uint32_t p99_us;
+
+    /// 99.9th percentile in microseconds
+    uint32_t p999_us;
+
+    /// Largest value in the window in microseconds
+    uint32_t max_us;
+
+    /// Number of values in the window
+    uint64_t samples;
+
+    /// Default constructor
+    LatencyPercentiles()
+        : p50_us(0), p99_us(0), p999_us(0), max_us(0), samples(0) {}
+};
+
+/// Outbound queue state and backpressure counters of WebSocket clients
+struct QueueStatistics {
+    /// Serialized bytes waiting to be written
+    size_t bytes_queued;
+
+    /// Highest bytes_queued seen
+    size_t peak_bytes_queued;
+
+    /// Messages discarded to stay within the byte budget
+    uint64_t messages_dropped;
+
+    /// Queued sonar points replaced by a newer reading at the same angle
+    uint64_t messages_conflated;
+
+    /// Sonar messages skipped by sweep decimation
+    uint64_t messages_decimated;
+
+    /// Current decimation: every Nth sweep is sent (1 = all)
+    uint32_t decimation_factor;
+
+    /// Default constructor
+    QueueStatistics()
+        : bytes_queued(0), peak_bytes_queued(0), messages_dropped(0)
+        , messages_conflated(0), messages_decimated(0), decimation_factor(1) {}
+};
+
+/// Queue state of one connected WebSocket client
+struct SessionQueueStatistics {
+    /// Client endpoint ("address:port")
+    std::string endpoint;
+
+    /// Backpressure policy name as given in the upgrade request
+    std::string policy;
+
+    /// Byte accounting and backpressure counters of this client
+    QueueStatistics queues;
+};
+
 /// Performance metrics for system monitoring
 struct PerformanceMetrics {
     /// Messages processed per second
@@ -184,12 +342,27 @@ struct PerformanceMetrics {
     /// Maximum processing latency in microseconds
     uint32_t max_latency_us;
 
+    /// I/O handler execution time distribution
+    LatencyPercentiles processing_latency;
+
+    /// Serial sample parsed -> handed to all sessions
+    LatencyPercentiles serial_to_broadcast_latency;
+
+    /// WebSocket write start -> completion, across all sessions
+    LatencyPercentiles session_write_latency;
+
     /// Memory usage in bytes
     size_t memory_usage_bytes;
 
     /// Active WebSocket connections count
     uint16_t active_connections;
 
+    /// Client queue totals: bytes over active connections, counters since start (peak and decimation: worst client)
+    QueueStatistics client_queues;
+
+    /// Queue state of each active connection
+    std::vector<SessionQueueStatistics> session_queues;
+
     /// Serial port status
     SerialStatus serial_status;
 
@@ -293,6 +466,9 @@ struct SerialStatistics {
     /// Total connection errors
     uint32_t connection_errors;
 
+    /// Receive buffer overflows (oversized message dropped, resynced on next delimiter)
+    uint32_t buffer_overflows;
+
     /// Last successful message timestamp
     std::chrono::steady_clock::time_point last_message_time;
 
@@ -305,7 +481,7 @@ struct SerialStatistics {
     /// Default constructor
     SerialStatistics()
         : messages_received(0), messages_sent(0), messages_per_second(0.0)
-        , parse_errors(0), connection_errors(0)
+        , parse_errors(0), connection_errors(0), buffer_overflows(0)
         , last_message_time(std::chrono::steady_clock::now())
         , uptime_seconds(0), avg_processing_time_us(0) {}
 };
@@ -10,7 +10,9 @@
 
 #pragma once
 
+#include <chrono>
 #include <string>
+#include <string_view>
 #include <optional>
 #include <regex>
 
@@ -22,17 +24,25 @@ namespace siren::serial {
  * @brief Arduino protocol parser for sonar data messages
  *
  * Military-grade protocol parser with:
- * - Regex-based message parsing
+ * - Allocation-free hand-written scanner (default)
+ * - Regex-based message parsing (selectable fallback)
  * - Hardware constraint validation
  * - Error handling and reporting
  * - Performance optimization
  */
 class ArduinoProtocolParser {
 public:
+    /// Parsing backend selection
+    enum class ParseMode : uint8_t {
+        SCANNER = 0,  ///< Hand-written std::from_chars scanner, no allocations
+        REGEX = 1     ///< std::regex fallback (reference implementation)
+    };
+
     /**
      * @brief Constructor - initializes parser with compiled regex
+     * @param mode Parsing backend to use for parseSonarData()
      */
-    ArduinoProtocolParser();
+    explicit ArduinoProtocolParser(ParseMode mode = ParseMode::SCANNER);
 
     /**
      * @brief Destructor - cleanup resources
@@ -47,10 +57,76 @@ public:
 
     /**
      * @brief Parse sonar data from Arduino message
-     * @param message Complete message from Arduino
+     * @param message Complete message from Arduino (without line terminator)
+     * @return Parsed sonar data point, or nullopt if parsing failed
+     */
+    std::optional<data::SonarDataPoint> parseSonarData(std::string_view message);
+
+    /**
+     * @brief Parse sonar data and the optional environmental trailer in one pass
+     * @param message Complete message from Arduino (without line terminator)
+     * @param environment Output: Temp/Humidity/SoundSpeed if present and valid, else nullopt
+     * @return Parsed sonar data point, or nullopt if parsing failed
+     */
+    std::optional<data::SonarDataPoint> parseSonarData(std::string_view message,
+                                                       std::optional<data::EnvironmentalData>& environment);
+
+    /**
+     * @brief Parse sonar data stamped with a receipt time taken by the caller
+     *
+     * Lets a reader take one clock reading per received chunk instead of one per line.
+     * @param message Complete message from Arduino (without line terminator)
+     * @param environment Output: Temp/Humidity/SoundSpeed if present and valid, else nullopt
+     * @param receipt_timestamp_us Steady clock receipt time in microseconds
      * @return Parsed sonar data point, or nullopt if parsing failed
      */
-    std::optional<data::SonarDataPoint> parseSonarData(const std::string& message);
+    std::optional<data::SonarDataPoint> parseSonarData(std::string_view message,
+                                                       std::optional<data::EnvironmentalData>& environment,
+                                                       uint64_t receipt_timestamp_us);
+
+    /**
+     * @brief Scan "Angle: X - Distance: Y" fields without allocating
+     * @param message Message span to scan
+     * @param angle Output angle in degrees
+     * @param distance Output distance in centimeters
+     * @return true if both fields were found, same acceptance as DATA_FORMAT_REGEX
+     */
+    static bool scanSonarFields(std::string_view message, int& angle, int& distance) noexcept;
+
+    /**
+     * @brief Scan sonar fields plus the " - Temp: T - Humidity: H[ - SoundSpeed: S]" trailer
+     * @param message Message span to scan
+     * @param angle Output angle in degrees
+     * @param distance Output distance in centimeters
+     * @param environment Output environmental fields, nullopt if the trailer is absent
+     * @return true if angle and distance were found
+     */
+    static bool scanSonarFields(std::string_view message, int& angle, int& distance,
+                                std::optional<data::EnvironmentalData>& environment) noexcept;
+
+    /**
+     * @brief Scan sonar fields and trailer, stamping the environment with a given receipt time
+     * @param message Message span to scan
+     * @param angle Output angle in degrees
+     * @param distance Output distance in centimeters
+     * @param environment Output environmental fields, nullopt if the trailer is absent
+     * @param receipt_timestamp_us Steady clock receipt time in microseconds
+     * @return true if angle and distance were found
+     */
+    static bool scanSonarFields(std::string_view message, int& angle, int& distance,
+                                std::optional<data::EnvironmentalData>& environment,
+                                uint64_t receipt_timestamp_us) noexcept;
+
+    /**
+     * @brief Select parsing backend
+     * @param mode Parsing backend to use for subsequent messages
+     */
+    void setParseMode(ParseMode mode) noexcept;
+
+    /**
+     * @brief Get current parsing backend
+     */
+    ParseMode getParseMode() const noexcept;
 
     /**
      * @brief Validate sonar data point against hardware constraints
@@ -59,6 +135,13 @@ public:
      */
     bool validateHardwareConstraints(const data::SonarDataPoint& data_point) const;
 
+    /**
+     * @brief Validate environmental sample against DHT11 specifications
+     * @param environment Environmental sample to validate
+     * @return true if temperature and humidity are within sensor range
+     */
+    bool validateEnvironmentalConstraints(const data::EnvironmentalData& environment) const;
+
     /**
      * @brief Get parsing statistics
      * @return Parsing performance metrics
@@ -68,11 +151,14 @@ public:
         uint64_t successful_parses;
         uint64_t failed_parses;
         uint64_t validation_failures;
-        uint32_t avg_parsing_time_us;
+        uint64_t environmental_samples;
+        uint64_t environmental_rejections;
+        uint32_t avg_parsing_time_us;     ///< EMA over sampled messages (1 in PARSE_TIMING_SAMPLE_INTERVAL)
 
         ParsingStatistics()
             : total_messages_processed(0), successful_parses(0)
             , failed_parses(0), validation_failures(0)
+            , environmental_samples(0), environmental_rejections(0)
             , avg_parsing_time_us(0) {}
     };
 
@@ -88,19 +174,36 @@ public:
     void resetStatistics();
 
 private:
-    /// Compiled regex pattern for efficient parsing
+    /// Compiled regex pattern for the REGEX fallback
     std::regex pattern_;
 
+    /// Active parsing backend
+    ParseMode mode_;
+
     /// Parsing statistics (mutable for const getStatistics())
     mutable ParsingStatistics statistics_;
 
     /**
      * @brief Update parsing statistics
-     * @param parsing_time_us Time taken for parsing in microseconds
+     * @param parsing_start Start of a timed parse, or nullopt when this message is not sampled
      * @param parse_successful Whether parsing was successful
      * @param validation_passed Whether validation passed
      */
-    void updateStatistics(uint32_t parsing_time_us, bool parse_successful, bool validation_passed) const;
+    void updateStatistics(const std::optional<std::chrono::steady_clock::time_point>& parsing_start,
+                          bool parse_successful, bool validation_passed) const;
+
+    /**
+     * @brief Extract fields using the compiled regex (REGEX mode)
+     * @param message Message span to parse
+     * @param angle Output angle in degrees
+     * @param distance Output distance in centimeters
+     * @param environment Output environmental fields, nullopt if the trailer is absent
+     * @param receipt_timestamp_us Steady clock receipt time in microseconds
+     * @return true if the pattern matched
+     */
+    bool matchSonarFields(std::string_view message, int& angle, int& distance,
+                          std::optional<data::EnvironmentalData>& environment,
+                          uint64_t receipt_timestamp_us) const;
 };
 
 } // namespace siren::serial
\ No newline at end of file
@@ -0,0 +1,106 @@
+/**
+ * @file binary_frame_decoder.hpp
+ * @brief Decoder for the COBS-framed binary Arduino protocol
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Decodes compact binary sample frames negotiated at startup.
+ * Implements SRP: Single responsibility for binary frame decoding and integrity checks.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <optional>
+
+#include "data/sonar_types.hpp"
+#include "serial/arduino_protocol_parser.hpp"
+
+namespace siren::serial {
+
+/**
+ * @brief Binary frame decoder for sonar samples
+ *
+ * Military-grade binary decoder with:
+ * - COBS unstuffing (frames are 0x00 delimited by the caller)
+ * - CRC16-CCITT integrity check
+ * - Hardware constraint validation shared with ArduinoProtocolParser
+ * - No text parsing and no heap allocations
+ */
+class BinaryFrameDecoder {
+public:
+    /// Decoded sample frame
+    struct DecodedFrame {
+        data::SonarDataPoint point;  ///< Carries the firmware transmission time in device_timestamp_us
+        std::optional<data::EnvironmentalData> environment;
+    };
+
+    /// Decoder statistics
+    struct DecoderStatistics {
+        uint64_t frames_decoded;
+        uint64_t framing_errors;
+        uint64_t crc_errors;
+        uint64_t validation_failures;
+
+        DecoderStatistics()
+            : frames_decoded(0), framing_errors(0)
+            , crc_errors(0), validation_failures(0) {}
+    };
+
+    /**
+     * @brief Constructor
+     * @param validator Parser whose hardware constraint checks are reused (SSOT)
+     */
+    explicit BinaryFrameDecoder(const ArduinoProtocolParser& validator);
+
+    ~BinaryFrameDecoder() = default;
+
+    // Non-copyable, non-movable
+    BinaryFrameDecoder(const BinaryFrameDecoder&) = delete;
+    BinaryFrameDecoder& operator=(const BinaryFrameDecoder&) = delete;
+    BinaryFrameDecoder(BinaryFrameDecoder&&) = delete;
+    BinaryFrameDecoder& operator=(BinaryFrameDecoder&&) = delete;
+
+    /**
+     * @brief Decode one COBS-encoded frame
+     * @param encoded Frame bytes without the 0x00 delimiter
+     * @param receipt_timestamp_us Steady clock receipt time in microseconds (stamped on the sample)
+     * @return Decoded frame, or nullopt on framing, CRC or validation failure
+     */
+    std::optional<DecodedFrame> decodeFrame(std::string_view encoded, uint64_t receipt_timestamp_us);
+
+    /**
+     * @brief COBS-decode a buffer
+     * @param input Encoded bytes (no delimiter)
+     * @param input_size Number of encoded bytes
+     * @param output Destination buffer
+     * @param output_capacity Destination capacity
+     * @return Decoded size, 0 if the input is malformed or does not fit
+     */
+    static size_t cobsDecode(const uint8_t* input, size_t input_size,
+                             uint8_t* output, size_t output_capacity) noexcept;
+
+    /**
+     * @brief Compute CRC-16/CCITT-FALSE
+     * @param data Bytes to checksum
+     * @param size Number of bytes
+     * @return CRC value
+     */
+    static uint16_t crc16(const uint8_t* data, size_t size) noexcept;
+
+    /**
+     * @brief Get decoder statistics
+     */
+    DecoderStatistics getStatistics() const noexcept;
+
+private:
+    /// Validation rules (shared with the ASCII parser)
+    const ArduinoProtocolParser& validator_;
+
+    /// Decoder statistics
+    DecoderStatistics statistics_;
+};
+
+} // namespace siren::serial
@@ -0,0 +1,123 @@
+/**
+ * @file capture_file.hpp
+ * @brief Raw serial capture writer and memory-mapped capture reader
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Records every received serial chunk with a monotonic timestamp so field
+ * incidents can be replayed byte-for-byte through the normal ingest path.
+ * Implements SRP: Single responsibility for capture file I/O.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace siren::serial {
+
+/**
+ * @brief Append-only capture file writer
+ *
+ * Each chunk is written with a single writev() so records are never
+ * interleaved or torn by buffering, even if the process crashes.
+ */
+class CaptureWriter {
+public:
+    CaptureWriter();
+    ~CaptureWriter();
+
+    // Non-copyable, non-movable (owns file descriptor)
+    CaptureWriter(const CaptureWriter&) = delete;
+    CaptureWriter& operator=(const CaptureWriter&) = delete;
+    CaptureWriter(CaptureWriter&&) = delete;
+    CaptureWriter& operator=(CaptureWriter&&) = delete;
+
+    /**
+     * @brief Open capture file for appending (header written if new)
+     * @param path Capture file path
+     * @return true if the file is ready for writing
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Append one received chunk
+     * @param timestamp_ns Monotonic receive time in nanoseconds
+     * @param data Chunk start
+     * @param size Chunk size in bytes
+     * @return true if the record was written completely
+     */
+    bool write(uint64_t timestamp_ns, const char* data, size_t size) noexcept;
+
+    /**
+     * @brief Close the capture file
+     */
+    void close() noexcept;
+
+    /**
+     * @brief Check whether a capture file is open
+     */
+    bool isOpen() const noexcept;
+
+private:
+    int fd_;
+};
+
+/**
+ * @brief Memory-mapped capture file reader
+ *
+ * Records are returned as views into the mapping; no data is copied.
+ * A truncated trailing record (e.g. after a crash) ends iteration cleanly.
+ */
+class CaptureReader {
+public:
+    /// One captured chunk
+    struct Record {
+        uint64_t timestamp_ns;
+        std::string_view data;
+    };
+
+    CaptureReader();
+    ~CaptureReader();
+
+    // Non-copyable, non-movable (owns mapping)
+    CaptureReader(const CaptureReader&) = delete;
+    CaptureReader& operator=(const CaptureReader&) = delete;
+    CaptureReader(CaptureReader&&) = delete;
+    CaptureReader& operator=(CaptureReader&&) = delete;
+
+    /**
+     * @brief Map a capture file and validate its header
+     * @param path Capture file path
+     * @return true if the file is a valid capture
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Read the next record
+     * @param record Output record, data valid while the reader is open
+     * @return false at end of capture
+     */
+    bool next(Record& record) noexcept;
+
+    /**
+     * @brief Restart iteration at the first record
+     */
+    void rewind() noexcept;
+
+    /**
+     * @brief Size of the mapped file in bytes
+     */
+    size_t size() const noexcept;
+
+private:
+    const char* mapping_;
+    size_t size_;
+    size_t offset_;
+
+    void unmap() noexcept;
+};
+
+} // namespace siren::serial
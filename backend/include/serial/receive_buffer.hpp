@@ -0,0 +1,97 @@
+/**
+ * @file receive_buffer.hpp
+ * @brief Fixed-capacity receive buffer for serial message assembly
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Contiguous buffer that async reads write into directly and that hands
+ * complete delimited messages out as string_views without copying.
+ * Implements SRP: Single responsibility for byte-stream to message framing.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "constants/communication.hpp"
+
+namespace siren::serial {
+
+/**
+ * @brief Zero-allocation delimited message assembler
+ *
+ * Usage per read completion:
+ * 1. Async read into writePointer()/writableSize(), then commit(n)
+ * 2. Drain with nextMessage() until it returns false
+ * 3. prepareWrite() before the next read (compacts, detects overflow)
+ *
+ * Only the trailing partial message is ever moved, so assembly is linear
+ * in the number of received bytes. A message that does not fit the buffer
+ * is dropped and the buffer resynchronizes on the next delimiter.
+ */
+class ReceiveBuffer {
+public:
+    /// Total capacity in bytes (read chunk x overflow multiplier)
+    static constexpr size_t CAPACITY = constants::communication::serial::BUFFER_SIZE *
+                                       constants::communication::serial::BUFFER_OVERFLOW_MULTIPLIER;
+
+    ReceiveBuffer() noexcept;
+    ~ReceiveBuffer() = default;
+
+    // Non-copyable, non-movable (async reads hold raw pointers into storage)
+    ReceiveBuffer(const ReceiveBuffer&) = delete;
+    ReceiveBuffer& operator=(const ReceiveBuffer&) = delete;
+    ReceiveBuffer(ReceiveBuffer&&) = delete;
+    ReceiveBuffer& operator=(ReceiveBuffer&&) = delete;
+
+    /**
+     * @brief Start of the free region for the next read
+     */
+    char* writePointer() noexcept;
+
+    /**
+     * @brief Size of the free region for the next read
+     */
+    size_t writableSize() const noexcept;
+
+    /**
+     * @brief Mark bytes written by the last read as received
+     * @param bytes Number of bytes written at writePointer()
+     */
+    void commit(size_t bytes) noexcept;
+
+    /**
+     * @brief Extract the next complete message
+     * @param delimiter Message delimiter ('\n' for lines, 0x00 for frames)
+     * @param message Output view into the buffer, valid until prepareWrite()/clear()
+     * @return true if a complete message was extracted
+     */
+    bool nextMessage(char delimiter, std::string_view& message) noexcept;
+
+    /**
+     * @brief Compact the partial message to the front before the next read
+     * @return true if the buffer overflowed and the partial message was dropped
+     */
+    bool prepareWrite() noexcept;
+
+    /**
+     * @brief Discard all buffered bytes and any pending resync
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Number of buffered bytes not yet extracted
+     */
+    size_t size() const noexcept;
+
+private:
+    std::array<char, CAPACITY> storage_;
+    size_t begin_;       ///< First unconsumed byte
+    size_t scan_;        ///< First byte not yet searched for a delimiter
+    size_t end_;         ///< One past the last received byte
+    bool resyncing_;     ///< Dropping bytes until the next delimiter after overflow
+};
+
+} // namespace siren::serial
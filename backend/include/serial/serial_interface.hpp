@@ -5,7 +5,8 @@
  * @date 2025
  *
  * Handles high-performance serial communication with Arduino UNO R3.
- * Implements protocol: "Angle: X - Distance: Y" at 9600 baud.
+ * Implements protocol: "Angle: X - Distance: Y" at 9600 baud, upgraded to
+ * COBS-framed binary samples at 115200 baud when the firmware acknowledges it.
  */
 
 #pragma once
@@ -15,10 +16,14 @@
 #include <functional>
 #include <atomic>
 #include <mutex>
+#include <optional>
 #include <boost/asio.hpp>
 
 #include "data/sonar_types.hpp"
 #include "serial/arduino_protocol_parser.hpp"
+#include "serial/binary_frame_decoder.hpp"
+#include "serial/receive_buffer.hpp"
+#include "serial/capture_file.hpp"
 
 namespace siren::serial {
 
@@ -42,9 +47,18 @@ public:
         ERROR           ///< Connection error
     };
 
+    /// Wire protocol in use on the current connection
+    enum class ProtocolMode : uint8_t {
+        ASCII = 0,   ///< Newline-terminated text lines (default, fallback)
+        BINARY = 1   ///< 0x00-delimited COBS frames with CRC16
+    };
+
     /// Data callback function type
     using DataCallback = std::function<void(const data::SonarDataPoint&)>;
 
+    /// Environmental sample callback type (fired only when the reading changes)
+    using EnvironmentCallback = std::function<void(const data::EnvironmentalData&)>;
+
     /// Error callback function type
     using ErrorCallback = std::function<void(const std::string&, data::ErrorSeverity)>;
 
@@ -83,6 +97,21 @@ public:
      */
     void stop();
 
+    /**
+     * @brief Record every received chunk to an append-only capture file
+     * @param path Capture file path (call before start())
+     * @return true if the capture file is ready
+     */
+    bool enableCapture(const std::string& path);
+
+    /**
+     * @brief Replay a capture file through the normal ingest path instead of a port
+     * @param path Capture file produced by enableCapture()
+     * @param speed Time scale: 1 = real time, N = N x faster, 0 = as fast as possible
+     * @return true if replay started
+     */
+    bool startReplay(const std::string& path, double speed);
+
     /**
      * @brief Check if connected to Arduino
      */
@@ -99,6 +128,18 @@ public:
      */
     void setDataCallback(DataCallback callback);
 
+    /**
+     * @brief Set environmental data callback
+     * @param callback Function to call when a new environmental reading arrives
+     */
+    void setEnvironmentCallback(EnvironmentCallback callback);
+
+    /**
+     * @brief Get the most recent environmental reading
+     * @return Cached reading, or nullopt if the firmware has not reported one
+     */
+    std::optional<data::EnvironmentalData> getLatestEnvironment() const;
+
     /**
      * @brief Set error callback
      * @param callback Function to call when errors occur
@@ -116,6 +157,11 @@ public:
      */
     void sendCommand(const std::string& command);
 
+    /**
+     * @brief Get wire protocol in use on the current connection
+     */
+    ProtocolMode getProtocolMode() const noexcept;
+
     /**
      * @brief Auto-detect Arduino port
      * @return Port name if found, empty string if not found
@@ -125,6 +171,7 @@ public:
 private:
     // Core components
     boost::asio::io_context& io_context_;
+    boost::asio::strand<boost::asio::io_context::executor_type> strand_;  ///< Serializes all serial handlers
     std::unique_ptr<boost::asio::serial_port> serial_port_;
     std::unique_ptr<boost::asio::steady_timer> reconnect_timer_;
 
@@ -133,16 +180,38 @@ private:
     std::atomic<bool> shutdown_requested_;
     std::string port_name_;
 
-    // Data handling
-    static constexpr size_t BUFFER_SIZE = 256;
-    std::array<char, BUFFER_SIZE> read_buffer_;
-    std::string message_buffer_;
+    // Data handling (async reads write straight into receive_buffer_)
+    ReceiveBuffer receive_buffer_;
     std::unique_ptr<ArduinoProtocolParser> protocol_parser_;
+    std::unique_ptr<BinaryFrameDecoder> frame_decoder_;
+
+    // Protocol negotiation
+    std::atomic<ProtocolMode> protocol_mode_;
+    bool binary_mode_requested_;
+
+    // Capture and replay
+    CaptureWriter capture_writer_;
+    CaptureReader replay_reader_;
+    std::unique_ptr<boost::asio::steady_timer> replay_timer_;
+    bool replaying_;
+    double replay_speed_;
+    uint64_t replay_previous_ns_;
+    uint64_t replay_offset_ns_;
+    uint64_t replay_chunks_;
+    uint64_t replay_bytes_;
+    std::chrono::steady_clock::time_point replay_start_;
+    CaptureReader::Record replay_record_;
+    bool replay_record_pending_;
 
     // Callbacks
     DataCallback data_callback_;
+    EnvironmentCallback environment_callback_;
     ErrorCallback error_callback_;
 
+    // Latest environmental reading (firmware repeats it on every line of a sweep)
+    mutable std::mutex environment_mutex_;
+    std::optional<data::EnvironmentalData> latest_environment_;
+
     // Statistics and monitoring
     mutable std::mutex stats_mutex_;
     data::SerialStatistics statistics_;
@@ -166,11 +235,64 @@ private:
      */
     void handleRead(const boost::system::error_code& error, std::size_t bytes_transferred);
 
+    /**
+     * @brief Feed one captured chunk through handleRead() as if it came from the port
+     * @param chunk Captured bytes
+     */
+    void feedReplayChunk(std::string_view chunk);
+
+    /**
+     * @brief Schedule the next replay step (timer in paced mode, post in AFAP mode)
+     */
+    void scheduleReplay();
+
+    /**
+     * @brief Feed all chunks that are due and reschedule
+     */
+    void onReplayStep();
+
+    /**
+     * @brief Report replay throughput and disconnect
+     */
+    void finishReplay();
+
     /**
      * @brief Process complete message from Arduino
-     * @param message Complete message string
+     * @param message Complete message view into the receive buffer
+     * @param receipt_timestamp_us Steady clock time the containing chunk was read, in microseconds
+     */
+    void processMessage(std::string_view message, uint64_t receipt_timestamp_us);
+
+    /**
+     * @brief Process complete binary frame from Arduino
+     * @param frame COBS-encoded frame without delimiter
+     * @param receipt_timestamp_us Steady clock time the containing chunk was read, in microseconds
+     */
+    void processFrame(std::string_view frame, uint64_t receipt_timestamp_us);
+
+    /**
+     * @brief Deliver a validated sample to statistics and callbacks
+     * @param point Validated sonar data point
+     * @param environment Environmental reading carried with the sample, if any
+     */
+    void deliverSample(const data::SonarDataPoint& point,
+                       const std::optional<data::EnvironmentalData>& environment);
+
+    /**
+     * @brief Ask the firmware to switch to the binary protocol
+     */
+    void requestBinaryProtocol();
+
+    /**
+     * @brief Switch baud rate and framing after the firmware acknowledged binary mode
+     */
+    void switchToBinaryProtocol();
+
+    /**
+     * @brief Cache environmental reading and notify only when it changed
+     * @param environment Environmental reading parsed from the current line
      */
-    void processMessage(const std::string& message);
+    void updateEnvironment(const data::EnvironmentalData& environment);
 
     /**
      * @brief Handle connection errors and attempt recovery
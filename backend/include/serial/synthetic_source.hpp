@@ -0,0 +1,121 @@
+/**
+ * @file synthetic_source.hpp
+ * @brief Built-in synthetic sonar source for running without hardware
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Generates SonarDataPoints from a scripted scene (room walls, moving
+ * targets, sensor noise) at a fixed rate from 10 to 1,000,000 samples/s,
+ * delivered through the same data callback as SerialInterface. Used to
+ * stress fan-out, serialization and the frontend far beyond the ~60 ms
+ * per step the servo allows.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <boost/asio.hpp>
+
+#include "data/sonar_types.hpp"
+
+namespace siren::serial {
+
+/**
+ * @brief Rate-paced scene generator feeding the sonar data callback
+ *
+ * Runs on its own strand. Each tick emits every sample that fell due since
+ * the previous one; sample timestamps are spaced exactly 1/rate apart, so
+ * consumers see the configured rate even when ticks are coalesced. If the
+ * consumers cannot keep up, samples older than MAX_LAG_US are skipped and
+ * counted rather than emitted late.
+ */
+class SyntheticSource {
+public:
+    /// Sonar data callback type (same signature as SerialInterface::DataCallback)
+    using DataCallback = std::function<void(const data::SonarDataPoint&)>;
+
+    /**
+     * @brief Construct synthetic source
+     * @param io_context I/O context running the generation timer
+     */
+    explicit SyntheticSource(boost::asio::io_context& io_context);
+
+    ~SyntheticSource();
+
+    // Non-copyable, non-movable
+    SyntheticSource(const SyntheticSource&) = delete;
+    SyntheticSource& operator=(const SyntheticSource&) = delete;
+    SyntheticSource(SyntheticSource&&) = delete;
+    SyntheticSource& operator=(SyntheticSource&&) = delete;
+
+    /**
+     * @brief Start generating samples
+     * @param rate_hz Samples per second (MIN_RATE_HZ to MAX_RATE_HZ)
+     * @return true if started
+     */
+    bool start(double rate_hz);
+
+    /**
+     * @brief Stop generating and report throughput
+     */
+    void stop();
+
+    /**
+     * @brief Set data callback
+     * @param callback Function to call for each generated sample
+     */
+    void setDataCallback(DataCallback callback);
+
+private:
+    boost::asio::strand<boost::asio::io_context::executor_type> strand_;  ///< Serializes generation ticks
+    std::unique_ptr<boost::asio::steady_timer> tick_timer_;
+    std::atomic<bool> running_;
+
+    // Pacing
+    double rate_hz_;
+    std::chrono::microseconds tick_interval_;
+    std::chrono::steady_clock::time_point start_time_;
+    uint64_t start_timestamp_us_;
+    uint64_t samples_due_;     ///< Index of the next sample to emit
+    uint64_t samples_emitted_;
+    uint64_t samples_skipped_;
+
+    // Scene state
+    int16_t angle_;
+    int16_t direction_;
+    std::mt19937 rng_;
+    std::normal_distribution<double> noise_;
+
+    DataCallback data_callback_;
+
+    /**
+     * @brief Arm the tick timer
+     */
+    void scheduleTick();
+
+    /**
+     * @brief Emit every sample due by now
+     */
+    void onTick();
+
+    /**
+     * @brief Generate the next sample of the sweep
+     * @param index Sample index since start (sets its timestamp)
+     */
+    data::SonarDataPoint nextSample(uint64_t index);
+
+    /**
+     * @brief Scene range along the beam at an angle
+     * @param angle_degrees Beam angle (90 = straight ahead)
+     * @param scene_time_s Sample time in seconds since start (moves targets)
+     * @return Nearest echo in centimeters, before noise and sensor clamping
+     */
+    static double sceneRange(int16_t angle_degrees, double scene_time_s);
+};
+
+} // namespace siren::serial
@@ -0,0 +1,75 @@
+/**
+ * @file binary_serializer.hpp
+ * @brief Fixed-layout binary frame serialization for the siren.bin.v2 subprotocol
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * SSOT for binary frame encoding. Layouts are defined in
+ * constants::message::binary_protocol; all fields are little-endian.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "data/sonar_types.hpp"
+
+namespace siren::utils {
+
+/**
+ * @brief Binary serializer with single responsibility
+ *
+ * Counterpart of JsonSerializer for clients that negotiated the binary
+ * subprotocol. Output is byte-order independent of the host.
+ */
+class BinarySerializer {
+public:
+    /**
+     * @brief Serialize sonar data point to a binary frame
+     * @param data Sonar data point to serialize
+     * @return SONAR_FRAME_SIZE bytes
+     */
+    static std::string serialize(const data::SonarDataPoint& data);
+
+    /**
+     * @brief Serialize a batch of sonar points to one binary frame
+     * @param batch Sonar batch to serialize (at most 65535 points)
+     * @return SONAR_BATCH_HEADER_SIZE + points * SONAR_BATCH_RECORD_SIZE bytes
+     */
+    static std::string serialize(const data::SonarBatch& batch);
+
+    /**
+     * @brief Serialize the latest-scan snapshot to one binary frame
+     * @param snapshot Latest reading per angle
+     * @return Batch-layout frame with FRAME_SCAN_SNAPSHOT type
+     */
+    static std::string serialize(const data::ScanSnapshot& snapshot);
+
+    /**
+     * @brief Serialize samples replayed to a resuming client to one binary frame
+     * @param replay Missed samples in sequence order
+     * @return Batch-layout frame with FRAME_SONAR_REPLAY type
+     */
+    static std::string serialize(const data::SonarReplay& replay);
+
+    /**
+     * @brief Serialize environmental calibration sample to a binary frame
+     * @param environment Environmental sample to serialize
+     * @return ENVIRONMENT_FRAME_SIZE bytes
+     */
+    static std::string serialize(const data::EnvironmentalData& environment);
+
+private:
+    /**
+     * @brief Serialize points in the sonar batch frame layout
+     * @param frame_type Frame type byte
+     * @param flags Flags byte
+     * @param sweep_count Sweep field of the header
+     * @param points Points to encode (at most 65535)
+     * @return SONAR_BATCH_HEADER_SIZE + points * SONAR_BATCH_RECORD_SIZE bytes
+     */
+    static std::string serializePoints(uint8_t frame_type, uint8_t flags, uint32_t sweep_count,
+                                       const std::vector<data::SonarDataPoint>& points);
+};
+
+} // namespace siren::utils
@@ -0,0 +1,80 @@
+/**
+ * @file change_detector.hpp
+ * @brief Per-angle change detection for delta-encoded sonar delivery
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Keeps the last distance sent at each angle. A point is emitted only if
+ * its distance moved more than the threshold, or its angle has not been
+ * sent for a keyframe interval. Clients that keep the latest reading per
+ * angle (seeded by the connect snapshot) reconstruct the full scan from
+ * these deltas; a mostly static scene costs one refresh per angle per
+ * keyframe interval instead of one frame per sample.
+ */
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <mutex>
+#include "constants/communication.hpp"
+#include "data/sonar_types.hpp"
+
+namespace siren::utils {
+
+/**
+ * @brief Thread-safe last-sent-value-per-angle table
+ *
+ * Each instance tracks one stream (every point of that stream must pass
+ * through it in acquisition order). Times are sample timestamps, so replays
+ * at any speed keyframe on the recorded timeline.
+ */
+class ChangeDetector {
+public:
+    ChangeDetector();
+
+    // Non-copyable, non-movable
+    ChangeDetector(const ChangeDetector&) = delete;
+    ChangeDetector& operator=(const ChangeDetector&) = delete;
+    ChangeDetector(ChangeDetector&&) = delete;
+    ChangeDetector& operator=(ChangeDetector&&) = delete;
+
+    /**
+     * @brief Set the change threshold and keyframe interval
+     * @param threshold_cm Emit when the distance moved more than this
+     * @param keyframe_interval_us Emit an unchanged angle after this long (0 = never)
+     */
+    void configure(int16_t threshold_cm, uint64_t keyframe_interval_us);
+
+    /**
+     * @brief Record a point and decide whether it is sent
+     * @param point Sonar point (angles outside the table are always sent)
+     * @return true if the point changed or its keyframe is due
+     */
+    bool update(const data::SonarDataPoint& point);
+
+    /**
+     * @brief Reduce a batch to the points that changed
+     * @param batch Batch in acquisition order
+     * @return Batch with the same sweep fields holding only emitted points
+     */
+    data::SonarBatch reduce(const data::SonarBatch& batch);
+
+private:
+    static constexpr size_t ANGLE_BIN_COUNT = constants::communication::subscription::ANGLE_BIN_COUNT;
+
+    std::mutex table_mutex_;
+    int16_t threshold_cm_;
+    uint64_t keyframe_interval_us_;
+    std::array<int16_t, ANGLE_BIN_COUNT> last_distance_;
+    std::array<uint64_t, ANGLE_BIN_COUNT> last_sent_us_;
+    std::bitset<ANGLE_BIN_COUNT> sent_;
+
+    /**
+     * @brief Decide and record one point (table_mutex_ held)
+     */
+    bool updateLocked(const data::SonarDataPoint& point);
+};
+
+} // namespace siren::utils
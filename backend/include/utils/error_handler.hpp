@@ -13,8 +13,8 @@
 #include "data/sonar_types.hpp"
 #include <string>
 #include <exception>
-#include <mutex>
 #include <atomic>
+#include <system_error>
 
 namespace siren::utils {
 
@@ -89,9 +89,6 @@ public:
                                  data::ErrorSeverity severity);
 
 private:
-    /// Thread-safe logging mutex
-    static std::mutex logging_mutex_;
-
     /// Error code counter for auto-generation
     static std::atomic<uint32_t> error_counter_;
 
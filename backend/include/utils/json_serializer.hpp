@@ -11,6 +11,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 #include "data/sonar_types.hpp"
 
 namespace siren::utils {
@@ -30,6 +31,34 @@ public:
      */
     static std::string serialize(const data::SonarDataPoint& data);
 
+    /**
+     * @brief Serialize a batch of sonar points to one JSON message
+     * @param batch Sonar batch to serialize
+     * @return JSON string representation
+     */
+    static std::string serialize(const data::SonarBatch& batch);
+
+    /**
+     * @brief Serialize the latest-scan snapshot to one JSON message
+     * @param snapshot Latest reading per angle
+     * @return JSON string representation
+     */
+    static std::string serialize(const data::ScanSnapshot& snapshot);
+
+    /**
+     * @brief Serialize samples replayed to a resuming client to one JSON message
+     * @param replay Missed samples in sequence order
+     * @return JSON string representation
+     */
+    static std::string serialize(const data::SonarReplay& replay);
+
+    /**
+     * @brief Serialize environmental calibration sample to JSON
+     * @param environment Environmental sample to serialize
+     * @return JSON string representation
+     */
+    static std::string serialize(const data::EnvironmentalData& environment);
+
     /**
      * @brief Serialize performance metrics to JSON
      * @param metrics Performance metrics to serialize
@@ -83,6 +112,39 @@ private:
     static std::string formatField(const char* key, const std::string& value, bool is_string = false);
     static std::string formatField(const char* key, const char* value, bool is_string = false);
 
+    /**
+     * @brief Helper to format a latency percentile object
+     * @param key Field name
+     * @param latency Percentile summary
+     * @return Formatted JSON field
+     */
+    static std::string formatLatency(const char* key, const data::LatencyPercentiles& latency);
+
+    /**
+     * @brief Helper to format an array of sonar point objects
+     * @param key Field name
+     * @param points Points in output order
+     * @return Formatted JSON field
+     */
+    static std::string formatPoints(const char* key, const std::vector<data::SonarDataPoint>& points);
+
+    /**
+     * @brief Helper to format a client queue statistics object
+     * @param key Field name
+     * @param queues Aggregated queue statistics
+     * @return Formatted JSON field
+     */
+    static std::string formatQueues(const char* key, const data::QueueStatistics& queues);
+
+    /**
+     * @brief Helper to format the per-client queue list
+     * @param key Field name
+     * @param sessions Queue statistics of each active client
+     * @return Formatted JSON field
+     */
+    static std::string formatSessionQueues(const char* key,
+                                           const std::vector<data::SessionQueueStatistics>& sessions);
+
     /**
      * @brief Helper to create timestamp field
      * @param timestamp Timestamp to format
@@ -0,0 +1,134 @@
+/**
+ * @file json_writer.hpp
+ * @brief Allocation-free JSON serialization into caller-provided buffers
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Hot-path counterpart of JsonSerializer. Field names and punctuation of
+ * each message type are assembled at compile time from the SSOT constants
+ * into a JsonSchema specialization; at run time only the values are
+ * formatted, with std::to_chars, straight into a fixed buffer. No streams,
+ * no locale, no heap.
+ *
+ * Output is byte-identical to JsonSerializer for the same message.
+ */
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include "constants/message.hpp"
+#include "data/sonar_types.hpp"
+
+namespace siren::utils {
+
+/**
+ * @brief Compile-time string assembled from SSOT constants
+ */
+struct JsonFragment {
+    static constexpr size_t CAPACITY = 64;
+
+    std::array<char, CAPACITY> chars{};
+    size_t size = 0;
+
+    constexpr std::string_view view() const noexcept {
+        return std::string_view(chars.data(), size);
+    }
+};
+
+/**
+ * @brief Concatenate string constants at compile time
+ * @param parts Null-terminated strings (total length below JsonFragment::CAPACITY)
+ */
+constexpr JsonFragment makeFragment(std::initializer_list<const char*> parts) {
+    JsonFragment fragment;
+    for (const char* part : parts) {
+        for (; *part != '\0'; ++part) {
+            fragment.chars[fragment.size++] = *part;
+        }
+    }
+    return fragment;
+}
+
+/**
+ * @brief Bounded writer over a caller-provided buffer
+ *
+ * Writes past the end are dropped and latch overflowed(); callers size
+ * buffers with JsonSchema<T>::MAX_SIZE so this never happens in practice.
+ */
+class JsonWriter {
+public:
+    JsonWriter(char* buffer, size_t capacity) noexcept
+        : buffer_(buffer)
+        , capacity_(capacity)
+        , size_(0)
+        , overflowed_(false) {}
+
+    /// Append compile-time text (field names, punctuation)
+    void literal(std::string_view text) noexcept {
+        if (text.size() > capacity_ - size_) {
+            overflowed_ = true;
+            return;
+        }
+        text.copy(buffer_ + size_, text.size());
+        size_ += text.size();
+    }
+
+    /// Append a decimal integer
+    template <typename Integer>
+    void integer(Integer value) noexcept {
+        const std::to_chars_result result = std::to_chars(buffer_ + size_, buffer_ + capacity_, value);
+        if (result.ec != std::errc()) {
+            overflowed_ = true;
+            return;
+        }
+        size_ = static_cast<size_t>(result.ptr - buffer_);
+    }
+
+    size_t size() const noexcept { return size_; }
+    bool overflowed() const noexcept { return overflowed_; }
+    std::string_view view() const noexcept { return std::string_view(buffer_, size_); }
+
+private:
+    char* buffer_;
+    size_t capacity_;
+    size_t size_;
+    bool overflowed_;
+};
+
+/**
+ * @brief Per-message-type field layout (specialized per serializable type)
+ */
+template <typename Message>
+struct JsonSchema;
+
+/// Sonar point: {"type":"sonar_data","timestamp":N,"angle":N,"distance":N,"quality":N,"seq":N}
+template <>
+struct JsonSchema<data::SonarDataPoint> {
+    /// Longest possible output (all values at their widest)
+    static constexpr size_t MAX_SIZE = 160;
+
+    /// Write the message; record form omits the type field (batch, snapshot and replay arrays)
+    static void write(const data::SonarDataPoint& point, JsonWriter& writer) noexcept;
+    static void writeRecord(const data::SonarDataPoint& point, JsonWriter& writer) noexcept;
+};
+
+/**
+ * @brief Serialize a message into a fixed buffer
+ * @param message Message with a JsonSchema specialization
+ * @param buffer Output buffer (at least JsonSchema<Message>::MAX_SIZE bytes)
+ * @param capacity Buffer size in bytes
+ * @return Bytes written, 0 if the buffer was too small
+ */
+template <typename Message>
+size_t serializeJson(const Message& message, char* buffer, size_t capacity) noexcept {
+    JsonWriter writer(buffer, capacity);
+    JsonSchema<Message>::write(message, writer);
+    return writer.overflowed() ? 0 : writer.size();
+}
+
+} // namespace siren::utils
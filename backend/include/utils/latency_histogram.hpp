@@ -0,0 +1,155 @@
+/**
+ * @file latency_histogram.hpp
+ * @brief Log-linear latency histogram (HDR-histogram style) and sliding percentile window
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Fixed memory, lock-free recording and mergeable, so tail latency
+ * (p99/p99.9) can be reported instead of an average that hides it.
+ *
+ * Bucket layout: values below 2 * 2^SUB_BUCKET_BITS are exact; every
+ * following power of two is split into 2^SUB_BUCKET_BITS equal sub-buckets,
+ * bounding the relative error of any reported value to 2^-SUB_BUCKET_BITS.
+ */
+
+#pragma once
+
+#include "constants/performance.hpp"
+#include "data/sonar_types.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace siren::utils {
+
+/**
+ * @brief Fixed-size log-linear histogram of microsecond values
+ *
+ * record() is lock-free and may be called from any thread. Reads
+ * (percentiles, merges) see a consistent-enough view for monitoring.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = constants::performance::histogram::SUB_BUCKET_BITS;
+    static constexpr uint64_t SUB_BUCKET_COUNT = uint64_t{1} << SUB_BUCKET_BITS;
+    static constexpr uint64_t MAX_VALUE = (uint64_t{1} << constants::performance::histogram::MAX_VALUE_BITS) - 1;
+    static constexpr size_t BUCKET_COUNT =
+        (constants::performance::histogram::MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    LatencyHistogram() noexcept;
+
+    // Non-copyable, non-movable (atomic counters)
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    /**
+     * @brief Record one value (saturates at MAX_VALUE)
+     * @param value_us Value in microseconds
+     */
+    void record(uint64_t value_us) noexcept;
+
+    /**
+     * @brief Add all counts of another histogram
+     * @param other Histogram to merge in
+     */
+    void merge(const LatencyHistogram& other) noexcept;
+
+    /**
+     * @brief Move all counts into target and reset this histogram
+     *
+     * Each bucket is exchanged atomically, so values recorded concurrently
+     * land in exactly one of the two histograms.
+     * @param target Histogram receiving the counts
+     */
+    void drainInto(LatencyHistogram& target) noexcept;
+
+    /**
+     * @brief Clear all counts
+     */
+    void reset() noexcept;
+
+    /// Number of recorded values
+    uint64_t getCount() const noexcept;
+
+    /// Sum of recorded values (for the mean)
+    uint64_t getTotal() const noexcept;
+
+    /// Largest recorded value
+    uint64_t getMax() const noexcept;
+
+    /**
+     * @brief Number of recorded values strictly above a threshold (bucket resolution)
+     * @param value_us Threshold in microseconds
+     */
+    uint64_t countAbove(uint64_t value_us) const noexcept;
+
+    /**
+     * @brief Value at or below which the given percentage of values fall
+     * @param percentile Percentile in [0, 100]
+     * @return Upper bound of the matching bucket (clamped to max), 0 if empty
+     */
+    uint64_t valueAtPercentile(double percentile) const noexcept;
+
+    /**
+     * @brief Summarize as p50/p99/p99.9/max
+     */
+    data::LatencyPercentiles summarize() const noexcept;
+
+    /// Bucket holding a value
+    static size_t bucketIndex(uint64_t value_us) noexcept;
+
+    /// Largest value mapped to a bucket
+    static uint64_t bucketUpperBound(size_t index) noexcept;
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> counts_;
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> total_;
+    std::atomic<uint64_t> max_;
+};
+
+/**
+ * @brief Percentiles over the last WINDOW_INTERVALS monitoring intervals
+ *
+ * Owned by a single thread: each interval's values are drained into a fresh
+ * slot (the oldest is discarded) and the slots are merged for reporting.
+ */
+class SlidingLatencyWindow {
+public:
+    SlidingLatencyWindow();
+
+    // Non-copyable, non-movable
+    SlidingLatencyWindow(const SlidingLatencyWindow&) = delete;
+    SlidingLatencyWindow& operator=(const SlidingLatencyWindow&) = delete;
+    SlidingLatencyWindow(SlidingLatencyWindow&&) = delete;
+    SlidingLatencyWindow& operator=(SlidingLatencyWindow&&) = delete;
+
+    /**
+     * @brief Start a new interval, discarding the oldest
+     * @return Empty histogram to fill with the new interval's values
+     */
+    LatencyHistogram& beginInterval() noexcept;
+
+    /**
+     * @brief Percentiles over all intervals in the window
+     */
+    data::LatencyPercentiles summarize() noexcept;
+
+    /**
+     * @brief Clear every interval
+     */
+    void reset() noexcept;
+
+private:
+    static constexpr size_t INTERVAL_COUNT = constants::performance::histogram::WINDOW_INTERVALS;
+
+    std::array<std::unique_ptr<LatencyHistogram>, INTERVAL_COUNT> intervals_;
+    std::unique_ptr<LatencyHistogram> merged_;  ///< Scratch space, avoids allocation per summary
+    size_t current_;
+};
+
+} // namespace siren::utils
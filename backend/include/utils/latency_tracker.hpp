@@ -0,0 +1,74 @@
+/**
+ * @file latency_tracker.hpp
+ * @brief Process-wide latency recording for the I/O thread pool
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Components record into a per-channel LatencyHistogram from any thread
+ * without locks; PerformanceMonitor drains the channels once per
+ * monitoring interval into its sliding windows.
+ */
+
+#pragma once
+
+#include "utils/latency_histogram.hpp"
+#include <chrono>
+#include <cstdint>
+
+namespace siren::utils {
+
+/// What a latency value measures
+enum class LatencyChannel : uint8_t {
+    HANDLER = 0,              ///< Completion handler execution time
+    SERIAL_TO_BROADCAST = 1,  ///< Sample parsed -> handed to every session
+    SESSION_WRITE = 2,        ///< WebSocket write start -> completion
+    COUNT = 3
+};
+
+/**
+ * @brief Static latency sink shared by all components
+ */
+class LatencyTracker {
+public:
+    LatencyTracker() = delete;
+
+    /**
+     * @brief Record one value
+     * @param channel Measurement channel
+     * @param duration_us Duration in microseconds
+     */
+    static void record(LatencyChannel channel, uint64_t duration_us) noexcept;
+
+    /**
+     * @brief Move everything recorded on a channel since the last drain into target
+     * @param channel Measurement channel
+     * @param target Histogram receiving the values
+     */
+    static void drainInto(LatencyChannel channel, LatencyHistogram& target) noexcept;
+};
+
+/**
+ * @brief RAII timer placed at the top of a completion handler
+ */
+class ScopedHandlerTimer {
+public:
+    ScopedHandlerTimer() noexcept
+        : start_(std::chrono::steady_clock::now()) {}
+
+    ~ScopedHandlerTimer() {
+        LatencyTracker::record(LatencyChannel::HANDLER,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start_).count()));
+    }
+
+    // Non-copyable, non-movable
+    ScopedHandlerTimer(const ScopedHandlerTimer&) = delete;
+    ScopedHandlerTimer& operator=(const ScopedHandlerTimer&) = delete;
+    ScopedHandlerTimer(ScopedHandlerTimer&&) = delete;
+    ScopedHandlerTimer& operator=(ScopedHandlerTimer&&) = delete;
+
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace siren::utils
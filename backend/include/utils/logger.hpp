@@ -0,0 +1,195 @@
+/**
+ * @file logger.hpp
+ * @brief Asynchronous level-filtered logging for military-grade components
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Hot-path logging without locks or flushes: messages are formatted into a
+ * fixed-size record on the caller's stack, pushed to a per-thread lock-free
+ * ring and written out by a background thread.
+ *
+ * Levels are filtered twice:
+ * - Compile time: SIREN_MIN_LOG_LEVEL (0 = DEBUG ... 5 = OFF) removes calls entirely
+ * - Run time: Logger::setLevel(), one relaxed atomic load per call site
+ */
+
+#pragma once
+
+#include "constants/error.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#ifndef SIREN_MIN_LOG_LEVEL
+#define SIREN_MIN_LOG_LEVEL 0
+#endif
+
+namespace siren::utils {
+
+/// Log severity levels (ordered)
+enum class LogLevel : uint8_t {
+    DEBUG = 0,      ///< Per-sample / per-message tracing (off by default)
+    INFO = 1,       ///< Lifecycle and state changes
+    WARNING = 2,    ///< Recoverable anomalies
+    ERROR = 3,      ///< Failed operations
+    CRITICAL = 4,   ///< System integrity at risk (written to stderr)
+    OFF = 5         ///< Disable logging
+};
+
+/// Lowest level kept by the compile-time filter
+inline constexpr int MIN_COMPILED_LOG_LEVEL = SIREN_MIN_LOG_LEVEL;
+
+/**
+ * @brief Compile-time filter used by SIREN_LOG
+ *
+ * Compares through a function so call sites do not expand to a constant
+ * comparison (-Wtype-limits when the minimum level is 0).
+ */
+constexpr bool isCompiledIn(LogLevel level) noexcept {
+    return static_cast<int>(level) >= MIN_COMPILED_LOG_LEVEL;
+}
+
+/**
+ * @brief Process-wide asynchronous logger
+ *
+ * Before start() (and after shutdown()) records are written synchronously,
+ * so tools and benchmarks that never start the writer still see output.
+ * If a thread's ring is full the record is dropped and counted; the hot
+ * path never blocks on I/O.
+ */
+class Logger {
+public:
+    Logger() = delete;
+
+    /**
+     * @brief Start the background writer thread
+     */
+    static void start();
+
+    /**
+     * @brief Drain all rings and stop the writer thread
+     */
+    static void shutdown() noexcept;
+
+    /**
+     * @brief Set runtime level; records below it are discarded at the call site
+     * @param level Minimum level to emit
+     */
+    static void setLevel(LogLevel level) noexcept;
+
+    /**
+     * @brief Get runtime level
+     */
+    static LogLevel getLevel() noexcept;
+
+    /**
+     * @brief Check whether a level passes the runtime filter
+     * @param level Level to check
+     */
+    static bool isEnabled(LogLevel level) noexcept {
+        return level >= runtime_level_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Submit a formatted record
+     * @param level Record level
+     * @param component Component name with static storage, nullptr if text is already prefixed
+     * @param text Message text
+     */
+    static void write(LogLevel level, const char* component, std::string_view text) noexcept;
+
+    /**
+     * @brief Number of records dropped because a ring was full
+     */
+    static uint64_t getDroppedCount() noexcept;
+
+    /**
+     * @brief Parse a level name ("debug", "info", "warning", "error", "critical", "off")
+     * @param name Level name
+     * @param level Output level
+     * @return true if the name was recognized
+     */
+    static bool parseLevel(std::string_view name, LogLevel& level) noexcept;
+
+private:
+    /// Runtime filter (inline so the call-site check needs no function call)
+    static inline std::atomic<LogLevel> runtime_level_{LogLevel::INFO};
+};
+
+/**
+ * @brief Fixed-capacity stream that formats one record without heap allocation
+ *
+ * Submits to Logger on destruction. Text beyond RECORD_TEXT_SIZE is truncated.
+ */
+class LogStream {
+public:
+    LogStream(LogLevel level, const char* component) noexcept
+        : level_(level), component_(component), length_(0) {}
+
+    ~LogStream() {
+        Logger::write(level_, component_, std::string_view(text_.data(), length_));
+    }
+
+    // Non-copyable, non-movable
+    LogStream(const LogStream&) = delete;
+    LogStream& operator=(const LogStream&) = delete;
+    LogStream(LogStream&&) = delete;
+    LogStream& operator=(LogStream&&) = delete;
+
+    LogStream& operator<<(std::string_view text) noexcept;
+    LogStream& operator<<(const char* text) noexcept;
+    LogStream& operator<<(const std::string& text) noexcept;
+    LogStream& operator<<(char c) noexcept;
+    LogStream& operator<<(double value) noexcept;
+
+    /// Integers (including bool and uint8_t) are written as numbers
+    template <typename T, typename std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, char>, int> = 0>
+    LogStream& operator<<(T value) noexcept {
+        if constexpr (std::is_signed_v<T>) {
+            return appendSigned(static_cast<long long>(value));
+        } else {
+            return appendUnsigned(static_cast<unsigned long long>(value));
+        }
+    }
+
+    /// Other streamable types (endpoints etc.) - cold path via ostringstream
+    template <typename T, typename std::enable_if_t<!std::is_arithmetic_v<T> &&
+                                                    !std::is_convertible_v<const T&, std::string_view>, int> = 0>
+    LogStream& operator<<(const T& value) {
+        std::ostringstream oss;
+        oss << value;
+        return *this << oss.str();
+    }
+
+private:
+    LogLevel level_;
+    const char* component_;
+    size_t length_;
+    std::array<char, constants::error::logging::RECORD_TEXT_SIZE> text_;
+
+    LogStream& appendSigned(long long value) noexcept;
+    LogStream& appendUnsigned(unsigned long long value) noexcept;
+};
+
+} // namespace siren::utils
+
+/// Log with compile-time and runtime filtering; message is a << chain
+#define SIREN_LOG(level, component, message)                                        \
+    do {                                                                            \
+        if constexpr (::siren::utils::isCompiledIn(level)) {                        \
+            if (::siren::utils::Logger::isEnabled(level)) {                         \
+                ::siren::utils::LogStream siren_log_stream_(level, component);      \
+                siren_log_stream_ << message;                                       \
+            }                                                                       \
+        }                                                                           \
+    } while (false)
+
+#define SIREN_LOG_DEBUG(component, message) SIREN_LOG(::siren::utils::LogLevel::DEBUG, component, message)
+#define SIREN_LOG_INFO(component, message) SIREN_LOG(::siren::utils::LogLevel::INFO, component, message)
+#define SIREN_LOG_WARNING(component, message) SIREN_LOG(::siren::utils::LogLevel::WARNING, component, message)
+#define SIREN_LOG_ERROR(component, message) SIREN_LOG(::siren::utils::LogLevel::ERROR, component, message)
+#define SIREN_LOG_CRITICAL(component, message) SIREN_LOG(::siren::utils::LogLevel::CRITICAL, component, message)
@@ -0,0 +1,68 @@
+/**
+ * @file replay_ring.hpp
+ * @brief Fixed-size ring of recently broadcast sonar samples
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Every broadcast sample carries a sequence number. A client that
+ * reconnects with the last one it received gets the samples it missed
+ * from this ring in a single replay frame, instead of a full re-sync.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "constants/communication.hpp"
+#include "data/sonar_types.hpp"
+
+namespace siren::utils {
+
+/**
+ * @brief Thread-safe replay ring, oldest sample overwritten when full
+ *
+ * push() runs once per sample on the broadcast path; the lock is held for
+ * a single slot write. collect() runs once per resuming client.
+ */
+class ReplayRing {
+public:
+    ReplayRing();
+
+    // Non-copyable, non-movable
+    ReplayRing(const ReplayRing&) = delete;
+    ReplayRing& operator=(const ReplayRing&) = delete;
+    ReplayRing(ReplayRing&&) = delete;
+    ReplayRing& operator=(ReplayRing&&) = delete;
+
+    /**
+     * @brief Append a sequenced sample, evicting the oldest when full
+     * @param point Sonar point in broadcast order
+     */
+    void push(const data::SonarDataPoint& point);
+
+    /**
+     * @brief Copy out every sample after the client's last sequence number
+     * @param last_sequence Last sequence number the client received
+     * @param now_us Steady clock time in microseconds
+     * @param replay Filled with the missed samples in sequence order
+     * @return false if part of the gap was evicted, is older than the window,
+     *         exceeds MAX_REPLAY_POINTS, or last_sequence is unknown
+     */
+    bool collect(uint32_t last_sequence, uint64_t now_us, data::SonarReplay& replay) const;
+
+    /**
+     * @brief True if sequence a comes after b (serial number arithmetic, survives wrap)
+     */
+    static bool isAfter(uint32_t a, uint32_t b) noexcept;
+
+private:
+    static constexpr size_t CAPACITY = constants::communication::resume::RING_CAPACITY;
+
+    mutable std::mutex ring_mutex_;
+    std::vector<data::SonarDataPoint> slots_;
+    size_t next_;   ///< Slot written by the next push
+    size_t count_;  ///< Occupied slots (up to CAPACITY)
+};
+
+} // namespace siren::utils
@@ -0,0 +1,61 @@
+/**
+ * @file scan_table.hpp
+ * @brief Latest sonar reading per angle bin
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * SSOT for "what the scope currently shows": one slot per degree,
+ * overwritten in O(1) by every sample. New clients receive it as a
+ * snapshot instead of waiting a full sweep for the picture to build up.
+ */
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <mutex>
+#include "constants/communication.hpp"
+#include "data/sonar_types.hpp"
+
+namespace siren::utils {
+
+/**
+ * @brief Thread-safe latest-reading-per-angle table
+ *
+ * update() runs once per sample on the acquisition path; the lock is held
+ * for a single slot write. snapshot() runs once per client connect.
+ */
+class ScanTable {
+public:
+    ScanTable();
+
+    // Non-copyable, non-movable
+    ScanTable(const ScanTable&) = delete;
+    ScanTable& operator=(const ScanTable&) = delete;
+    ScanTable(ScanTable&&) = delete;
+    ScanTable& operator=(ScanTable&&) = delete;
+
+    /**
+     * @brief Store a sample as the latest reading at its angle
+     * @param point Sonar point (angles outside the table are ignored)
+     */
+    void update(const data::SonarDataPoint& point);
+
+    /**
+     * @brief Copy out the readings not older than max_age_us
+     * @param now_us Steady clock time in microseconds
+     * @param max_age_us Oldest reading age to include
+     * @return Points in ascending angle order
+     */
+    data::ScanSnapshot snapshot(uint64_t now_us, uint64_t max_age_us) const;
+
+private:
+    static constexpr size_t ANGLE_BIN_COUNT = constants::communication::subscription::ANGLE_BIN_COUNT;
+
+    mutable std::mutex table_mutex_;
+    std::array<data::SonarDataPoint, ANGLE_BIN_COUNT> latest_;
+    std::bitset<ANGLE_BIN_COUNT> occupied_;
+};
+
+} // namespace siren::utils
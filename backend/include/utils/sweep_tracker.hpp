@@ -0,0 +1,44 @@
+/**
+ * @file sweep_tracker.hpp
+ * @brief Servo sweep detection from consecutive sonar angles
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * SSOT for sweep boundary detection: a sweep ends when the servo
+ * reverses direction.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "data/sonar_types.hpp"
+
+namespace siren::utils {
+
+/**
+ * @brief Tracks SweepState from the angles of consecutive points
+ *
+ * Not thread-safe; each owner feeds it from a single strand.
+ */
+class SweepTracker {
+public:
+    SweepTracker();
+
+    /**
+     * @brief Advance with the next point's angle
+     * @param angle Servo angle of the point in acquisition order
+     * @return true if the angle reverses the sweep direction (the point opens a new sweep)
+     */
+    bool update(int16_t angle);
+
+    /**
+     * @brief Current sweep state (sweep_count = sweeps completed so far)
+     */
+    const data::SweepState& getState() const noexcept;
+
+private:
+    data::SweepState state_;
+    bool has_position_;
+};
+
+} // namespace siren::utils
@@ -7,8 +7,11 @@
  * Single Responsibility: Coordinate data broadcasting between components ONLY
  *
  * RESPONSIBILITIES:
- * - Coordinate sonar data broadcasting
+ * - Coordinate sonar data broadcasting (per point and per batch)
  * - Coordinate performance metrics broadcasting
+ * - Maintain the latest-scan table for late-joining clients
+ * - Keep recent samples for clients resuming after a reconnect
+ * - Detect changed points for delta-encoded clients
  * - Manage session-to-broadcaster communication
  * - Handle broadcast state validation
  *
@@ -30,6 +33,9 @@
 #include <atomic>
 
 #include "data/sonar_types.hpp"
+#include "utils/change_detector.hpp"
+#include "utils/replay_ring.hpp"
+#include "utils/scan_table.hpp"
 
 namespace siren::websocket {
 
@@ -74,6 +80,22 @@ public:
     void broadcastSonarData(const data::SonarDataPoint& data, 
                            const std::atomic<bool>& running);
 
+    /**
+     * @brief Coordinate sonar batch broadcast (SSOT for batch broadcasting)
+     * @param batch Sonar batch to broadcast
+     * @param running Reference to server running state for validation
+     */
+    void broadcastSonarBatch(const data::SonarBatch& batch,
+                            const std::atomic<bool>& running);
+
+    /**
+     * @brief Coordinate environmental sample broadcast (SSOT for environment broadcasting)
+     * @param environment Environmental sample to broadcast
+     * @param running Reference to server running state for validation
+     */
+    void broadcastEnvironmentData(const data::EnvironmentalData& environment,
+                                  const std::atomic<bool>& running);
+
     /**
      * @brief Coordinate performance metrics broadcast (SSOT for metrics broadcasting)
      * @param metrics Performance metrics to broadcast
@@ -82,10 +104,41 @@ public:
     void broadcastPerformanceMetrics(const data::PerformanceMetrics& metrics,
                                    const std::atomic<bool>& running);
 
+    /**
+     * @brief Set what counts as a change for delta-encoded clients
+     * @param threshold_cm Send a point when its distance moved more than this
+     * @param keyframe_interval_us Resend an unchanged angle after this long (0 = never)
+     */
+    void configureDeltaEncoding(int16_t threshold_cm, uint64_t keyframe_interval_us);
+
+    /**
+     * @brief Get the latest reading per angle for a newly connected client
+     * @return Recent points in ascending angle order
+     */
+    data::ScanSnapshot getScanSnapshot() const;
+
+    /**
+     * @brief Get the samples a reconnecting client missed
+     * @param last_sequence Last sequence number the client received
+     * @param replay Filled with the missed samples in sequence order
+     * @return false if the gap is no longer fully held (client needs the scan snapshot)
+     */
+    bool getReplay(uint32_t last_sequence, data::SonarReplay& replay) const;
+
 private:
     // Component references - not owned, avoid circular dependencies
     std::shared_ptr<SessionManager>& session_manager_;
     std::unique_ptr<MessageBroadcaster>& message_broadcaster_;
+
+    // Latest reading per angle (updated on every broadcast sample)
+    utils::ScanTable scan_table_;
+
+    // Recently broadcast samples for resuming clients
+    utils::ReplayRing replay_ring_;
+
+    // Last value sent per angle, one per stream (per-point and per-batch see different orders)
+    utils::ChangeDetector point_changes_;
+    utils::ChangeDetector batch_changes_;
 };
 
 } // namespace siren::websocket
\ No newline at end of file
@@ -15,6 +15,8 @@
 #include <functional>
 #include <atomic>
 #include "data/sonar_types.hpp"
+#include "websocket/shared_message.hpp"
+#include "websocket/subscription_filter.hpp"
 
 namespace siren::websocket {
 
@@ -90,11 +92,31 @@ public:
     /**
      * @brief Broadcast sonar data to all active sessions (SSOT for sonar broadcasting)
      * @param data Sonar data point to broadcast
+     * @param changed true if delta-encoded sessions receive the point too
      * @param sessions Container of active sessions to broadcast to
      */
     void broadcastSonarData(const data::SonarDataPoint& data,
+                           bool changed,
                            const SessionContainer& sessions);
 
+    /**
+     * @brief Broadcast a sonar batch to per-batch sessions (SSOT for batch broadcasting)
+     * @param batch Sonar batch to broadcast (full-encoded sessions)
+     * @param delta_batch The same batch reduced to changed points (delta-encoded sessions)
+     * @param sessions Container of active sessions to broadcast to
+     */
+    void broadcastSonarBatch(const data::SonarBatch& batch,
+                            const data::SonarBatch& delta_batch,
+                            const SessionContainer& sessions);
+
+    /**
+     * @brief Broadcast environmental sample to all active sessions (SSOT for environment broadcasting)
+     * @param environment Environmental sample to broadcast
+     * @param sessions Container of active sessions to broadcast to
+     */
+    void broadcastEnvironmentData(const data::EnvironmentalData& environment,
+                                  const SessionContainer& sessions);
+
     /**
      * @brief Broadcast performance metrics to all active sessions (SSOT for metrics broadcasting)
      * @param metrics Performance metrics to broadcast
@@ -111,6 +133,29 @@ public:
     void broadcastMessage(const std::string& message,
                          const SessionContainer& sessions);
 
+    /**
+     * @brief Broadcast a serialized-once buffer to all active sessions
+     *
+     * Every session queues the same buffer; per-client cost is a pointer copy.
+     * @param message Shared serialized message
+     * @param sessions Container of active sessions to broadcast to
+     */
+    void broadcastMessage(const SharedMessage& message,
+                         const SessionContainer& sessions);
+
+    /**
+     * @brief Broadcast per-protocol encodings of the same message
+     *
+     * Sessions that negotiated the binary subprotocol get binary_message,
+     * all others json_message. A null encoding is skipped for its sessions.
+     * @param json_message Text encoding (JSON clients)
+     * @param binary_message Binary encoding (siren.bin.v2 clients)
+     * @param sessions Container of active sessions to broadcast to
+     */
+    void broadcastMessage(const SharedMessage& json_message,
+                         const SharedMessage& binary_message,
+                         const SessionContainer& sessions);
+
     /**
      * @brief Set callback for broadcast completion (SSOT for callback setting)
      * @param callback Function to call when broadcast completes
@@ -145,11 +190,53 @@ private:
     /**
      * @brief Send message to individual session (SSOT for session messaging)
      * @param session Target session
-     * @param message Message to send
+     * @param message Shared message to send
      * @return true if message sent successfully
      */
-    bool sendToSession(std::shared_ptr<WebSocketSession> session,
-                      const std::string& message);
+    bool sendToSession(const std::shared_ptr<WebSocketSession>& session,
+                      const SharedMessage& message);
+
+    /**
+     * @brief Send per-protocol encodings to the sessions a message is meant for
+     *
+     * A session receives the message if accepts(session, subscription) holds
+     * and its subscription rate cap for the topic admits it.
+     * @param json_message Text encoding (JSON clients)
+     * @param binary_message Binary encoding (siren.bin.v2 clients)
+     * @param sessions Container of active sessions to broadcast to
+     * @param topic Subscription topic of the message
+     * @param accepts Predicate (const WebSocketSession&, const SubscriptionFilter&) -> bool
+     */
+    template <typename Accepts>
+    void deliverMessage(const SharedMessage& json_message,
+                       const SharedMessage& binary_message,
+                       const SessionContainer& sessions,
+                       SubscriptionTopic topic,
+                       Accepts accepts);
+
+    /**
+     * @brief Serialize a batch once per protocol and send it to the sessions it is meant for
+     * @param batch Sonar batch (skipped if empty)
+     * @param sessions Container of active sessions to broadcast to
+     * @param accepts Predicate (const WebSocketSession&, const SubscriptionFilter&) -> bool
+     */
+    template <typename Accepts>
+    void deliverBatch(const data::SonarBatch& batch,
+                     const SessionContainer& sessions,
+                     Accepts accepts);
+
+    /**
+     * @brief Send a batch reduced to one session's sectors and range gate
+     * @param session Per-batch session with a spatial subscription
+     * @param subscription Session's subscription snapshot
+     * @param batch Full sonar batch
+     * @param now_us Broadcast time for the rate cap
+     * @return true if a non-empty batch was sent
+     */
+    bool sendFilteredBatch(const std::shared_ptr<WebSocketSession>& session,
+                          const SubscriptionFilter& subscription,
+                          const data::SonarBatch& batch,
+                          uint64_t now_us);
 
     /**
      * @brief Notify broadcast completion (SSOT for completion notification)
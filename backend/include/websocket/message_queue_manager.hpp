@@ -8,10 +8,18 @@
  *
  * RESPONSIBILITIES:
  * - Thread-safe message queuing for single client
- * - Queue size monitoring and backpressure implementation
- * - Client disconnect decisions based on queue overflow
+ * - Byte budget accounting and backpressure policy enforcement
+ * - Drop, conflation and decimation counters for monitoring
+ * - Client disconnect decisions (disconnect policy only)
  * - Queue state management (empty/full checks)
  *
+ * BACKPRESSURE POLICIES (bound: constants::communication::backpressure::MAX_QUEUED_BYTES):
+ * - DISCONNECT: close the client when the budget would be exceeded
+ * - DROP_OLDEST: discard the oldest queued messages to make room
+ * - CONFLATE_PER_ANGLE: a sonar point replaces the queued point at the same angle
+ * - DECIMATE_SWEEPS: send every Nth sweep, N adapting to the queue depth
+ * Every policy except DISCONNECT falls back to DROP_OLDEST at the hard bound.
+ *
  * NOT RESPONSIBLE FOR:
  * - WebSocket protocol handling (handled by WebSocketSession)
  * - Message serialization (handled by caller)
@@ -26,14 +34,27 @@
 
 #pragma once
 
+#include <array>
 #include <mutex>
-#include <queue>
+#include <deque>
 #include <string>
 #include <atomic>
 #include <functional>
+#include "constants/communication.hpp"
+#include "data/sonar_types.hpp"
+#include "utils/sweep_tracker.hpp"
+#include "websocket/shared_message.hpp"
 
 namespace siren::websocket {
 
+/// Per-session reaction to a client that reads slower than data is produced
+enum class BackpressurePolicy : uint8_t {
+    DISCONNECT = 0,          ///< Close the connection at the byte budget
+    DROP_OLDEST = 1,         ///< Discard oldest messages (default)
+    CONFLATE_PER_ANGLE = 2,  ///< Keep only the newest queued point per angle bin
+    DECIMATE_SWEEPS = 3      ///< Send every Nth sweep while the queue is deep
+};
+
 /**
  * @brief Message queue manager with single responsibility
  *
@@ -66,21 +87,33 @@ public:
     MessageQueueManager(MessageQueueManager&&) = delete;
     MessageQueueManager& operator=(MessageQueueManager&&) = delete;
 
+    /**
+     * @brief Select the backpressure policy (before the first message)
+     * @param policy Policy negotiated in the upgrade request
+     */
+    void setPolicy(BackpressurePolicy policy);
+
+    /**
+     * @brief Current backpressure policy
+     */
+    BackpressurePolicy getPolicy() const;
+
     /**
      * @brief Enqueue message with backpressure management (SSOT for queuing)
-     * @param message Message to enqueue
+     * @param message Shared message buffer to enqueue (no payload copy)
      * @param write_in_progress Current write state
-     * @return true if message enqueued, false if client should be disconnected
+     * @return true if message accepted (queued, conflated or decimated),
+     *         false if rejected or client should be disconnected
      */
-    bool enqueueMessage(const std::string& message, 
+    bool enqueueMessage(SharedMessage message,
                        const std::atomic<bool>& write_in_progress);
 
     /**
      * @brief Get next message from queue (SSOT for dequeuing)
-     * @param message Output parameter for the message
+     * @param message Output parameter for the shared message buffer
      * @return true if message retrieved, false if queue empty
      */
-    bool getNextMessage(std::string& message);
+    bool getNextMessage(SharedMessage& message);
 
     /**
      * @brief Check if queue is empty (SSOT for queue state)
@@ -94,6 +127,11 @@ public:
      */
     size_t size() const;
 
+    /**
+     * @brief Snapshot of byte accounting and backpressure counters
+     */
+    data::QueueStatistics getStatistics() const;
+
     /**
      * @brief Clear all messages from queue (SSOT for queue cleanup)
      */
@@ -102,13 +140,48 @@ public:
 private:
     // Queue state management
     mutable std::mutex queue_mutex_;
-    std::queue<std::string> message_queue_;
+    std::deque<SharedMessage> message_queue_;
+    uint64_t front_sequence_;  ///< Enqueue sequence of message_queue_.front()
+    BackpressurePolicy policy_;
+
+    // Byte accounting and counters (guarded by queue_mutex_)
+    data::QueueStatistics statistics_;
+    bool above_warning_;
+
+    // Conflation: queued sequence + 1 of the newest point per angle bin (0 = none)
+    std::array<uint64_t, constants::communication::backpressure::ANGLE_BIN_COUNT> angle_slots_;
+
+    // Decimation: sweep tracking for this client's message stream
+    utils::SweepTracker sweep_tracker_;
+    uint32_t current_sweep_;
 
     // Client information
     std::string client_endpoint_;
 
     // Callbacks
     QueueFullCallback queue_full_callback_;
+
+    /**
+     * @brief Replace the queued point at the same angle (lock held)
+     * @return true if the message was conflated into an existing slot
+     */
+    bool conflate(const SharedMessage& message);
+
+    /**
+     * @brief Decide whether the message falls in a decimated sweep (lock held)
+     * @return true if the message should be skipped
+     */
+    bool decimate(const MessageTag& tag);
+
+    /**
+     * @brief Remove the oldest message and account for it (lock held)
+     */
+    void popFront();
+
+    /**
+     * @brief Angle bin index for a point tag, or ANGLE_BIN_COUNT if out of range
+     */
+    static size_t angleBin(int16_t angle) noexcept;
 };
 
 } // namespace siren::websocket
\ No newline at end of file
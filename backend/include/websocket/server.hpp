@@ -99,6 +99,25 @@ public:
      */
     void broadcastSonarData(const data::SonarDataPoint& data);
 
+    /**
+     * @brief Broadcast a sonar batch to clients that chose per-batch delivery
+     * @param batch Sonar batch to broadcast
+     */
+    void broadcastSonarBatch(const data::SonarBatch& batch);
+
+    /**
+     * @brief Set what counts as a change for clients that chose delta encoding
+     * @param threshold_cm Send a point when its distance moved more than this
+     * @param keyframe_interval_us Resend an unchanged angle after this long (0 = never)
+     */
+    void configureDeltaEncoding(int16_t threshold_cm, uint64_t keyframe_interval_us);
+
+    /**
+     * @brief Broadcast environmental calibration sample to all connected clients
+     * @param environment Environmental sample to broadcast
+     */
+    void broadcastEnvironmentData(const data::EnvironmentalData& environment);
+
     /**
      * @brief Broadcast performance metrics to all connected clients
      * @param metrics Performance metrics to broadcast
@@ -110,6 +129,31 @@ public:
      */
     size_t getActiveConnections() const noexcept;
 
+    /**
+     * @brief Get client queue statistics aggregated over all sessions
+     * @return Bytes summed over active sessions; counters summed since start,
+     *         including disconnected clients; peak and decimation factor are the maximum
+     */
+    data::QueueStatistics getQueueStatistics() const;
+
+    /**
+     * @brief Get queue statistics of each active session
+     */
+    std::vector<data::SessionQueueStatistics> getSessionQueueStatistics() const;
+
+    /**
+     * @brief Get the latest reading per angle for a newly connected client
+     */
+    data::ScanSnapshot getScanSnapshot() const;
+
+    /**
+     * @brief Get the samples a reconnecting client missed
+     * @param last_sequence Last sequence number the client received
+     * @param replay Filled with the missed samples in sequence order
+     * @return false if the gap is no longer fully held
+     */
+    bool getReplay(uint32_t last_sequence, data::SonarReplay& replay) const;
+
     /**
      * @brief Get server statistics
      */
@@ -8,6 +8,11 @@
  *
  * RESPONSIBILITIES:
  * - WebSocket protocol handling (handshake, read, write)
+ * - Subprotocol negotiation (JSON text default, siren.bin.v2 binary)
+ * - Sonar delivery selection (?delivery=point|batch on the upgrade request)
+ * - Sonar encoding selection (?encoding=full|delta on the upgrade request)
+ * - Resume after reconnect (?last_seq=N replays missed samples before live data)
+ * - Subscription filter updates from client subscribe messages
  * - Message serialization and transmission
  * - Connection state management for single client
  * - Client endpoint information
@@ -26,15 +31,19 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 #include <atomic>
+#include <chrono>
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
+#include <boost/beast/http.hpp>
 #include <boost/beast/websocket.hpp>
 
 #include "data/sonar_types.hpp"
 #include "websocket/message_queue_manager.hpp"
+#include "websocket/subscription_filter.hpp"
 
 namespace siren::websocket {
 
@@ -45,6 +54,18 @@ using tcp = boost::asio::ip::tcp;
 // Forward declaration to avoid circular dependency
 class WebSocketServer;
 
+/// How a client receives sonar points
+enum class SonarDelivery : uint8_t {
+    PER_POINT = 0,  ///< One frame per point (default, legacy clients)
+    PER_BATCH = 1   ///< One frame per SweepBatcher batch
+};
+
+/// Which sonar points a client receives
+enum class SonarEncoding : uint8_t {
+    FULL = 0,   ///< Every point (default, legacy clients)
+    DELTA = 1   ///< Only points that changed or whose keyframe is due
+};
+
 /**
  * @brief WebSocket session for individual clients with single responsibility
  *
@@ -92,13 +113,21 @@ public:
     void sendPerformanceMetrics(const data::PerformanceMetrics& metrics);
 
     /**
-     * @brief Send generic message to client
+     * @brief Send generic message to client (safe from any thread)
      * @param message Serialized message to send
      */
     void sendMessage(const std::string& message);
 
     /**
-     * @brief Close the connection gracefully
+     * @brief Send a shared message buffer to client (safe from any thread)
+     *
+     * Broadcast path: the buffer is queued by reference, not copied.
+     * @param message Shared serialized message
+     */
+    void sendMessage(SharedMessage message);
+
+    /**
+     * @brief Close the connection gracefully (safe from any thread)
      */
     void close();
 
@@ -112,6 +141,50 @@ public:
      */
     std::string getClientEndpoint() const;
 
+    /**
+     * @brief Check if the client negotiated the binary subprotocol
+     * @return true for siren.bin.v2, false for JSON text frames
+     */
+    bool usesBinaryProtocol() const noexcept;
+
+    /**
+     * @brief Get the sonar delivery mode requested at handshake
+     */
+    SonarDelivery getSonarDelivery() const noexcept;
+
+    /**
+     * @brief Get the sonar encoding requested at handshake
+     */
+    SonarEncoding getSonarEncoding() const noexcept;
+
+    /**
+     * @brief Get this client's queue depth and backpressure counters
+     */
+    data::QueueStatistics getQueueStatistics() const;
+
+    /**
+     * @brief Get this client's queue statistics with its endpoint and policy
+     */
+    data::SessionQueueStatistics getSessionQueueStatistics() const;
+
+    /**
+     * @brief Get the client's current subscription filter
+     * @return Immutable snapshot (never null; accept-all until the client subscribes)
+     */
+    SubscriptionSnapshot getSubscription() const;
+
+    /**
+     * @brief Apply the subscription rate cap to one message
+     *
+     * Call once per message that passed the filter; a true result counts
+     * as a delivery for the topic.
+     * @param subscription Snapshot the message was filtered with
+     * @param topic Topic of the message
+     * @param now_us Steady clock time in microseconds
+     * @return true if the message may be sent now
+     */
+    bool admitMessage(const SubscriptionFilter& subscription, SubscriptionTopic topic, uint64_t now_us);
+
 private:
     // WebSocket stream - RAII managed
     websocket::stream<beast::tcp_stream> ws_;
@@ -125,14 +198,68 @@ private:
     // Connection state - atomic for thread safety
     std::atomic<bool> is_alive_;
     std::atomic<bool> closing_;
+    std::atomic<bool> binary_protocol_;  ///< Set during handshake, before is_alive_
+    std::atomic<SonarDelivery> sonar_delivery_;  ///< Set during handshake, before is_alive_
+    std::atomic<SonarEncoding> sonar_encoding_;  ///< Set during handshake, before is_alive_
+
+    // HTTP upgrade request - read first so the subprotocol can be negotiated
+    beast::http::request<beast::http::string_body> upgrade_request_;
+
+    // Resume request from the upgrade query (strand only)
+    bool resume_requested_;
+    uint32_t resume_sequence_;
+
+    // Newest sequence sent in the replay; live sonar up to it is a duplicate (strand only)
+    bool replay_pending_;
+    uint32_t replay_sequence_;
 
     // Message queue management - SRP compliant delegation
     std::unique_ptr<MessageQueueManager> queue_manager_;
     std::atomic<bool> write_in_progress_;
+    SharedMessage write_message_;  ///< Message currently being written (strand only)
+    std::chrono::steady_clock::time_point write_started_;  ///< For write latency (strand only)
+
+    // Subscription - replaced with std::atomic_store from the session strand
+    SubscriptionSnapshot subscription_;
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(SubscriptionTopic::COUNT)> last_delivery_us_;
 
     // Read buffer - RAII managed
     beast::flat_buffer buffer_;
 
+    /**
+     * @brief Configure stream and start handshake (runs on session strand)
+     */
+    void onStart();
+
+    /**
+     * @brief Send the server's latest-scan snapshot after the handshake (runs on session strand)
+     */
+    void sendScanSnapshot();
+
+    /**
+     * @brief Send the samples missed since last_sequence as one replay frame (runs on session strand)
+     * @param last_sequence Last sequence number the client received
+     * @return false if the gap is no longer held (caller falls back to the snapshot)
+     */
+    bool sendReplay(uint32_t last_sequence);
+
+    /**
+     * @brief Apply a client control message (runs on session strand)
+     * @param message Text frame payload
+     */
+    void handleControlMessage(const std::string& message);
+
+    /**
+     * @brief Close the stream and deregister from server (runs on session strand)
+     */
+    void onClose();
+
+    /**
+     * @brief Negotiate subprotocol and accept the upgrade request
+     * @param ec Error code from HTTP read operation
+     */
+    void onUpgradeRequest(beast::error_code ec);
+
     /**
      * @brief Handle WebSocket handshake (SSOT for handshake logic)
      * @param ec Error code from handshake operation
@@ -159,10 +286,16 @@ private:
     void processNextMessage();
 
     /**
-     * @brief Enqueue message for sending (SSOT for message queuing)
-     * @param message Serialized message to send
+     * @brief Hand a message to the session strand for queuing
+     * @param message Shared serialized message
+     */
+    void postMessage(SharedMessage message);
+
+    /**
+     * @brief Enqueue message for sending (SSOT for message queuing, session strand only)
+     * @param message Shared serialized message
      */
-    void enqueueMessage(const std::string& message);
+    void enqueueMessage(SharedMessage message);
 
     /**
      * @brief Handle connection errors (SSOT for error handling)
@@ -12,11 +12,13 @@
 
 #include <memory>
 #include <vector>
+#include <unordered_map>
 #include <functional>
 #include <atomic>
 #include <mutex>
 #include <boost/asio.hpp>
 #include <boost/beast.hpp>
+#include "data/sonar_types.hpp"
 
 namespace siren::websocket {
 
@@ -47,12 +49,22 @@ class WebSocketServer;
  * - Rule 21.2.1: RAII for all resources
  * - Rule 8.4.1: Single responsibility per class
  * - Rule 18.1.1: Thread-safe container access
+ *
+ * CONCURRENCY (copy-on-write registry):
+ * Readers atomically load an immutable snapshot and iterate it without
+ * locking; one snapshot load replaces a per-broadcast vector copy.
+ * Writers (connect/disconnect, rare) serialize on a mutex, build a new
+ * container and atomically publish it. Retired snapshots are freed when
+ * their last reader releases them.
  */
 class SessionManager {
 public:
     /// Session container type (SSOT for session storage)
     using SessionContainer = std::vector<std::shared_ptr<WebSocketSession>>;
 
+    /// Immutable published view of the active sessions (SSOT for broadcast iteration)
+    using SessionSnapshot = std::shared_ptr<const SessionContainer>;
+
     /// Callback type for session events (SSOT)
     using SessionEventCallback = std::function<void(const std::string&, bool)>;
 
@@ -89,9 +101,9 @@ public:
 
     /**
      * @brief Get active sessions for broadcasting (SSOT for session access)
-     * @return Container of active sessions
+     * @return Immutable snapshot of active sessions (never null; keep it while iterating)
      */
-    SessionContainer getActiveSessions() const;
+    SessionSnapshot getActiveSessions() const;
 
     /**
      * @brief Get count of active sessions (SSOT for session counting)
@@ -99,6 +111,12 @@ public:
      */
     size_t getActiveSessionCount() const noexcept;
 
+    /**
+     * @brief Get backpressure counters of sessions already removed
+     * @return Dropped/conflated/decimated totals and worst peak; bytes_queued is 0
+     */
+    data::QueueStatistics getRetiredQueueStatistics() const;
+
     /**
      * @brief Close all sessions gracefully (SSOT for bulk session closure)
      */
@@ -116,9 +134,16 @@ public:
     void setSessionCallback(SessionEventCallback callback);
 
 private:
-    // Session storage - thread-safe access required
-    mutable std::mutex sessions_mutex_;
-    SessionContainer active_sessions_;
+    // Session storage - readers use std::atomic_load, writers hold sessions_mutex_
+    std::mutex sessions_mutex_;
+    SessionSnapshot active_sessions_;
+
+    // Position of each session in the published container (writer side only)
+    std::unordered_map<const WebSocketSession*, size_t> session_index_;
+
+    // Counters of removed sessions, so published totals never go down
+    mutable std::mutex retired_mutex_;
+    data::QueueStatistics retired_queues_;
 
     // Session event notification (SSOT)
     SessionEventCallback session_callback_;
@@ -130,6 +155,18 @@ private:
     static constexpr size_t CLEANUP_THRESHOLD = 10;  // Cleanup after N session changes
     static constexpr const char* COMPONENT_NAME = "SessionManager";
 
+    /**
+     * @brief Atomically replace the published snapshot (sessions_mutex_ held)
+     * @param sessions Container matching session_index_
+     */
+    void publishSessions(SessionContainer&& sessions);
+
+    /**
+     * @brief Add a session's backpressure counters to the retired totals
+     * @param session Session leaving the registry
+     */
+    void retireQueueStatistics(const WebSocketSession& session);
+
     /**
      * @brief Notify session event (SSOT for event notification)
      * @param endpoint Client endpoint
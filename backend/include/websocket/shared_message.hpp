@@ -0,0 +1,80 @@
+/**
+ * @file shared_message.hpp
+ * @brief Immutable reference-counted WebSocket message buffer
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * A broadcast is serialized once; every session queue holds a pointer to
+ * the same buffer, and the pending async_write keeps it alive until the
+ * write completes. Fan-out cost is one pointer copy per client.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace siren::websocket {
+
+/// WebSocket frame opcode a message is written with
+enum class FrameType : uint8_t {
+    TEXT = 0,    ///< JSON (default protocol)
+    BINARY = 1   ///< siren.bin.v2 fixed-layout frame
+};
+
+/// What a message carries, for backpressure decisions in the session queue
+enum class MessageKind : uint8_t {
+    GENERIC = 0,      ///< Metrics, status, environment (never conflated or decimated)
+    SONAR_POINT = 1,  ///< Single sonar point (conflatable per angle)
+    SONAR_BATCH = 2   ///< Sonar batch (decimatable per sweep)
+};
+
+/// Backpressure metadata attached at serialization time
+struct MessageTag {
+    MessageKind kind = MessageKind::GENERIC;
+    int16_t angle = 0;    ///< SONAR_POINT: servo angle
+    uint32_t sweep = 0;   ///< SONAR_BATCH: sweep index
+    uint32_t sequence = 0;  ///< Sonar: newest sample sequence number carried (0 = unsequenced)
+
+    static MessageTag sonarPoint(int16_t point_angle, uint32_t point_sequence) {
+        MessageTag tag;
+        tag.kind = MessageKind::SONAR_POINT;
+        tag.angle = point_angle;
+        tag.sequence = point_sequence;
+        return tag;
+    }
+
+    static MessageTag sonarBatch(uint32_t batch_sweep, uint32_t newest_sequence) {
+        MessageTag tag;
+        tag.kind = MessageKind::SONAR_BATCH;
+        tag.sweep = batch_sweep;
+        tag.sequence = newest_sequence;
+        return tag;
+    }
+};
+
+/// Serialized payload plus the frame type it must be sent as
+struct OutboundMessage {
+    std::string payload;
+    FrameType frame_type;
+    MessageTag tag;
+};
+
+/// Serialized message shared by all session queues (never modified after creation)
+using SharedMessage = std::shared_ptr<const OutboundMessage>;
+
+/**
+ * @brief Wrap a serialized message for shared fan-out
+ * @param payload Serialized message (moved, not copied)
+ * @param frame_type Frame type to send it as
+ * @param tag Backpressure metadata
+ * @return Shared immutable buffer
+ */
+inline SharedMessage makeSharedMessage(std::string&& payload,
+                                       FrameType frame_type = FrameType::TEXT,
+                                       MessageTag tag = MessageTag{}) {
+    return std::make_shared<const OutboundMessage>(OutboundMessage{std::move(payload), frame_type, tag});
+}
+
+} // namespace siren::websocket
@@ -0,0 +1,108 @@
+/**
+ * @file subscription_filter.hpp
+ * @brief Per-client subscription filter for broadcast data
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Single Responsibility: Decide which broadcast data one client receives
+ *
+ * Clients send a subscribe control message; each one replaces the previous
+ * filter. Every field is optional and an absent field does not restrict:
+ *
+ *   {"type":"subscribe",
+ *    "sectors":[[0,45],[135,180]],                   // inclusive angle ranges (degrees)
+ *    "min_distance_cm":10, "max_distance_cm":200,    // sonar range gate
+ *    "types":["sonar_data","performance_metrics"],   // topics by message type
+ *    "max_rate_hz":20}                               // per-topic rate cap
+ *
+ * Sectors are precomputed into a per-angle bitmask, so the broadcast path
+ * costs one bit test and two compares per sample.
+ */
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "constants/communication.hpp"
+
+namespace siren::websocket {
+
+/// Broadcast data categories a client can subscribe to
+enum class SubscriptionTopic : uint8_t {
+    SONAR = 0,        ///< sonar_data and sonar_batch
+    ENVIRONMENT = 1,  ///< environment_data
+    METRICS = 2,      ///< performance_metrics
+    STATUS = 3,       ///< status_update and other text broadcasts
+    COUNT = 4
+};
+
+/// Outcome of parsing a client control message
+enum class SubscriptionParseResult : uint8_t {
+    SUBSCRIPTION = 0,      ///< Valid subscribe message, filter replaced
+    NOT_SUBSCRIPTION = 1,  ///< Some other message type, filter untouched
+    INVALID = 2            ///< Malformed subscribe message, filter untouched
+};
+
+/**
+ * @brief Immutable-after-parse subscription filter
+ *
+ * Default constructed filter accepts everything at any rate.
+ */
+class SubscriptionFilter {
+public:
+    SubscriptionFilter();
+
+    /**
+     * @brief Parse a client control message
+     * @param message Text frame received from the client
+     * @param filter Replaced with the parsed filter on SUBSCRIPTION
+     * @param error Reason on INVALID
+     */
+    static SubscriptionParseResult parse(const std::string& message,
+                                         SubscriptionFilter& filter,
+                                         std::string& error);
+
+    /**
+     * @brief Check whether a topic is subscribed
+     */
+    bool acceptsTopic(SubscriptionTopic topic) const noexcept;
+
+    /**
+     * @brief Check a sonar point against the sectors and range gate
+     */
+    bool acceptsPoint(int16_t angle, int16_t distance_cm) const noexcept;
+
+    /**
+     * @brief True if sectors or range gate may reject sonar points
+     */
+    bool isSpatial() const noexcept;
+
+    /**
+     * @brief Minimum interval between messages of one topic (0 = unlimited)
+     */
+    uint32_t getMinIntervalUs() const noexcept;
+
+    /**
+     * @brief Short human-readable summary for logging
+     */
+    std::string describe() const;
+
+private:
+    static constexpr size_t ANGLE_BIN_COUNT = constants::communication::subscription::ANGLE_BIN_COUNT;
+    static constexpr size_t TOPIC_COUNT = static_cast<size_t>(SubscriptionTopic::COUNT);
+
+    std::bitset<ANGLE_BIN_COUNT> angles_;
+    std::bitset<TOPIC_COUNT> topics_;
+    int16_t min_distance_cm_;
+    int16_t max_distance_cm_;
+    uint32_t max_rate_hz_;
+    uint32_t min_interval_us_;
+    bool spatial_;
+};
+
+/// Published filter shared between the session strand and broadcasters
+using SubscriptionSnapshot = std::shared_ptr<const SubscriptionFilter>;
+
+} // namespace siren::websocket
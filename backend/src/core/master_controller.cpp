@@ -12,22 +12,32 @@
 #include "constants/error.hpp"
 #include "constants/communication.hpp"
 #include "utils/error_handler.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
+#include <algorithm>
 #include <chrono>
+#include <csignal>
 #include <exception>
 #include <thread>
+#include <vector>
 
 namespace siren::core {
 
 using namespace std::chrono_literals;
 namespace cnst = siren::constants;
 
-MasterController::MasterController()
+// SSOT for log component name (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr const char* COMPONENT_NAME = "MasterController";
+}
+
+MasterController::MasterController(const ControllerOptions& options)
     : io_context_(nullptr)
     , heartbeat_timer_(nullptr)
+    , options_(options)
+    , sample_sequence_(0)
     , shutdown_requested_(false)
 {
-    std::cout << "[MasterController] Initializing military-grade sonar controller..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing military-grade sonar controller...");
 }
 
 MasterController::~MasterController() {
@@ -49,22 +59,22 @@ bool MasterController::initialize() {
         performance_monitor_->setMetricsCallback(
             [this](const auto& metrics) { onMetricsUpdate(metrics); });
 
-        std::cout << "[MasterController] Phase 1: I/O Context initialization..." << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Phase 1: I/O Context initialization...");
         initializeIOContext();
 
-        std::cout << "[MasterController] Phase 2: Subsystems initialization..." << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Phase 2: Subsystems initialization...");
         if (!initializeSubsystems()) {
             utils::ErrorHandler::handleInitializationError("MasterController", "subsystem initialization", "Failed to initialize subsystems");
             return false;
         }
 
-        std::cout << "[MasterController] Phase 3: Periodic tasks setup..." << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Phase 3: Periodic tasks setup...");
         setupPeriodicTasks();
 
         // Start performance monitoring
         performance_monitor_->start();
 
-        std::cout << "[MasterController] ✅ Initialization complete - Military-grade ready" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "✅ Initialization complete - Military-grade ready");
         return true;
 
     } catch (const std::exception& e) {
@@ -77,12 +87,12 @@ bool MasterController::start() {
     auto current_state = state_manager_->getCurrentState();
     if (current_state != SystemStateManager::SystemState::INITIALIZING &&
         current_state != SystemStateManager::SystemState::STOPPED) {
-        std::cout << "[MasterController] ⚠️ Cannot start - invalid state" << std::endl;
+        SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Cannot start - invalid state");
         return false;
     }
 
     try {
-        std::cout << "[MasterController] 🚀 Starting military-grade operations..." << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "🚀 Starting military-grade operations...");
 
         if (!state_manager_->updateState(SystemStateManager::SystemState::RUNNING)) {
             utils::ErrorHandler::handleSystemError("MasterController",
@@ -90,7 +100,7 @@ bool MasterController::start() {
             return false;
         }
 
-        std::cout << "[MasterController] ✅ System operational - Military-grade performance active" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "✅ System operational - Military-grade performance active");
         return true;
 
     } catch (const std::exception& e) {
@@ -102,11 +112,11 @@ bool MasterController::start() {
 
 void MasterController::run() {
     if (!state_manager_->isOperational()) {
-        std::cout << "[MasterController] ⚠️ Cannot run - system not operational" << std::endl;
+        SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Cannot run - system not operational");
         return;
     }
 
-    std::cout << "[MasterController] 🎯 Entering main event loop - Military-grade timing active" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "🎯 Entering main event loop - Military-grade timing active");
 
     try {
         // Start heartbeat
@@ -115,45 +125,23 @@ void MasterController::run() {
                 onHeartbeat(error);
             });
 
-        // Main event loop - simplified coordination-focused design
-        while (!shutdown_requested_.load() && state_manager_->isOperational()) {
-            try {
-                auto work_start = std::chrono::steady_clock::now();
-
-                // Process I/O events
-                auto processed = io_context_->poll();
-
-                auto work_duration = std::chrono::steady_clock::now() - work_start;
-                auto work_us = std::chrono::duration_cast<std::chrono::microseconds>(work_duration).count();
-
-                // Record performance metrics
-                performance_monitor_->recordProcessingTime(work_us);
+        // Blocking executor: every thread sleeps in the reactor until work arrives
+        const size_t thread_count = std::max<size_t>(1, options_.io_threads);
+        SIREN_LOG_INFO(COMPONENT_NAME, "Running I/O context on " << thread_count << " thread(s)");
 
-                // Check for high latency
-                if (work_us > cnst::performance::timing::MAX_LATENCY_US) {
-                    std::cout << "[MasterController] ⚠️ High latency detected: "
-                              << work_us << "μs (target: "
-                              << cnst::performance::timing::TARGET_LOOP_TIME_US << "μs)" << std::endl;
-                }
+        std::vector<std::thread> workers;
+        workers.reserve(thread_count - 1);
+        for (size_t i = 1; i < thread_count; ++i) {
+            workers.emplace_back([this]() { runEventLoop(); });
+        }
 
-                // Maintain target timing
-                if (processed == 0) {
-                    std::this_thread::sleep_for(std::chrono::microseconds(
-                        cnst::performance::timing::TARGET_LOOP_TIME_US / cnst::performance::optimization::SPIN_PREVENTION_DIVISOR));
-                }
+        runEventLoop();
 
-                auto remaining_time = std::chrono::microseconds(cnst::performance::timing::TARGET_LOOP_TIME_US) - work_duration;
-                if (remaining_time > std::chrono::microseconds::zero()) {
-                    std::this_thread::sleep_for(remaining_time);
-                }
-
-            } catch (const std::exception& e) {
-                utils::ErrorHandler::handleException("MasterController", "event loop processing", e, data::ErrorSeverity::ERROR);
-                std::this_thread::sleep_for(cnst::error::handling::ERROR_RECOVERY_DELAY);
-            }
+        for (auto& worker : workers) {
+            worker.join();
         }
 
-        std::cout << "[MasterController] 🛑 Event loop terminated" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "🛑 Event loop terminated");
 
     } catch (const std::exception& e) {
         utils::ErrorHandler::handleException("MasterController", "critical event loop", e, data::ErrorSeverity::FATAL);
@@ -163,34 +151,34 @@ void MasterController::run() {
 }
 
 void MasterController::stop() {
-    std::cout << "[MasterController] 🛑 Initiating graceful shutdown..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "🛑 Initiating graceful shutdown...");
 
     state_manager_->updateState(SystemStateManager::SystemState::STOPPING);
     shutdown_requested_.store(true);
 
-    // Cancel pending operations
-    if (heartbeat_timer_) {
-        heartbeat_timer_->cancel();
+    // Wake every I/O thread; run() joins them and cleans up
+    if (io_context_) {
+        io_context_->stop();
     }
 
     state_manager_->updateState(SystemStateManager::SystemState::STOPPED);
-    std::cout << "[MasterController] ✅ Graceful shutdown complete" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "✅ Graceful shutdown complete");
 }
 
 void MasterController::pause() {
     if (state_manager_->getCurrentState() == SystemStateManager::SystemState::RUNNING) {
-        std::cout << "[MasterController] ⏸️ Pausing operations..." << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "⏸️ Pausing operations...");
         state_manager_->updateState(SystemStateManager::SystemState::PAUSING);
         state_manager_->updateState(SystemStateManager::SystemState::PAUSED);
-        std::cout << "[MasterController] ✅ System paused" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "✅ System paused");
     }
 }
 
 void MasterController::resume() {
     if (state_manager_->getCurrentState() == SystemStateManager::SystemState::PAUSED) {
-        std::cout << "[MasterController] ▶️ Resuming operations..." << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "▶️ Resuming operations...");
         state_manager_->updateState(SystemStateManager::SystemState::RUNNING);
-        std::cout << "[MasterController] ✅ System resumed" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "✅ System resumed");
     }
 }
 
@@ -208,7 +196,7 @@ bool MasterController::isHealthy() const noexcept {
 
 void MasterController::emergencyShutdown() noexcept {
     try {
-        std::cout << "[MasterController] 🚨 EMERGENCY SHUTDOWN" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "🚨 EMERGENCY SHUTDOWN");
 
         shutdown_requested_.store(true);
 
@@ -220,10 +208,10 @@ void MasterController::emergencyShutdown() noexcept {
             io_context_->stop();
         }
 
-        std::cout << "[MasterController] 🛑 Emergency shutdown complete" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "🛑 Emergency shutdown complete");
 
     } catch (...) {
-        std::cout << "[MasterController] ❌ Emergency shutdown failed" << std::endl;
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Emergency shutdown failed");
     }
 }
 
@@ -231,50 +219,46 @@ void MasterController::initializeIOContext() {
     io_context_ = std::make_unique<boost::asio::io_context>();
     heartbeat_timer_ = std::make_unique<boost::asio::steady_timer>(*io_context_);
 
-    std::cout << "[MasterController] I/O context initialized with military-grade timers" << std::endl;
+    // Graceful shutdown on Ctrl+C / service stop
+    shutdown_signals_ = std::make_unique<boost::asio::signal_set>(*io_context_, SIGINT, SIGTERM);
+    shutdown_signals_->async_wait(
+        [this](const boost::system::error_code& error, int signal_number) {
+            if (!error) {
+                SIREN_LOG_INFO(COMPONENT_NAME, "Received signal " << signal_number);
+                stop();
+            }
+        });
+
+    SIREN_LOG_INFO(COMPONENT_NAME, "I/O context initialized with military-grade timers");
 }
 
 bool MasterController::initializeSubsystems() {
     try {
         // Initialize SerialInterface
-        std::cout << "[MasterController] Initializing SerialInterface..." << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Initializing SerialInterface...");
         serial_interface_ = std::make_unique<serial::SerialInterface>(*io_context_);
 
         // Set up callbacks for sonar data and errors
         serial_interface_->setDataCallback(
             [this](const data::SonarDataPoint& data) { onSonarData(data); });
 
+        serial_interface_->setEnvironmentCallback(
+            [this](const data::EnvironmentalData& environment) { onEnvironmentData(environment); });
+
         serial_interface_->setErrorCallback(
             [this](const std::string& error, data::ErrorSeverity severity) {
                 onSerialError(error, severity); });
 
-        // Auto-detect Arduino port
-        const std::string detected_port = serial::SerialInterface::autoDetectArduinoPort();
-        if (detected_port.empty()) {
-            std::cout << "[MasterController] ⚠️ No Arduino detected - running in demo mode" << std::endl;
-            utils::ErrorHandler::handleSystemError("MasterController",
-                "Arduino port auto-detection failed - continuing without hardware", data::ErrorSeverity::WARNING);
-            // Don't return false - continue without Arduino
-        } else {
-            // Initialize and start serial communication
-            if (!serial_interface_->initialize(detected_port)) {
-                std::cout << "[MasterController] ⚠️ Arduino initialization failed - running in demo mode" << std::endl;
-                utils::ErrorHandler::handleSystemError("MasterController",
-                    "SerialInterface initialization failed - continuing without hardware", data::ErrorSeverity::WARNING);
-            } else if (!serial_interface_->start()) {
-                std::cout << "[MasterController] ⚠️ Arduino start failed - running in demo mode" << std::endl;
-                utils::ErrorHandler::handleSystemError("MasterController",
-                    "SerialInterface start failed - continuing without hardware", data::ErrorSeverity::WARNING);
-            } else {
-                std::cout << "[MasterController] ✅ SerialInterface initialized on port: " << detected_port << std::endl;
-            }
-        }
+        startSerialSource();
 
         // Initialize WebSocket server
-        std::cout << "[MasterController] Initializing WebSocket server..." << std::endl;
-        websocket_server_ = std::make_unique<websocket::WebSocketServer>(*io_context_,
+        SIREN_LOG_INFO(COMPONENT_NAME, "Initializing WebSocket server...");
+        websocket_server_ = std::make_shared<websocket::WebSocketServer>(*io_context_,
             siren::constants::communication::websocket::DEFAULT_PORT);
 
+        websocket_server_->configureDeltaEncoding(options_.delta_threshold_cm,
+                                                  options_.delta_keyframe_interval_us);
+
         // Initialize and start WebSocket server
         if (!websocket_server_->initialize()) {
             utils::ErrorHandler::handleSystemError("MasterController",
@@ -288,21 +272,82 @@ bool MasterController::initializeSubsystems() {
             return false;
         }
 
-        std::cout << "[MasterController] ✅ WebSocket server started on port "
-                  << siren::constants::communication::websocket::DEFAULT_PORT << std::endl;
-        std::cout << "[MasterController] Data processor: PLACEHOLDER (pending implementation)" << std::endl;
-        std::cout << "[MasterController] Logger: PLACEHOLDER (pending implementation)" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "✅ WebSocket server started on port "
+                                       << siren::constants::communication::websocket::DEFAULT_PORT);
+
+        // Batching stage for clients that chose per-batch sonar delivery
+        sweep_batcher_ = std::make_unique<SweepBatcher>(*io_context_, options_.batch_max_points,
+            std::chrono::microseconds(options_.batch_max_delay_us));
+        sweep_batcher_->setBatchCallback(
+            [this](const data::SonarBatch& batch) {
+                if (websocket_server_ && websocket_server_->isRunning()) {
+                    websocket_server_->broadcastSonarBatch(batch);
+                }
+            });
+        SIREN_LOG_INFO(COMPONENT_NAME, "Data processor: PLACEHOLDER (pending implementation)");
 
         return true;
 
     } catch (const std::exception& e) {
-        std::cout << "[MasterController] ❌ Subsystem initialization failed: " << e.what() << std::endl;
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Subsystem initialization failed: " << e.what());
         return false;
     }
 }
 
+void MasterController::startSerialSource() {
+    // Synthetic scene replaces the device entirely, through the same data path
+    if (options_.synthetic_rate_hz > 0.0) {
+        synthetic_source_ = std::make_unique<serial::SyntheticSource>(*io_context_);
+        synthetic_source_->setDataCallback(
+            [this](const data::SonarDataPoint& data) { onSonarData(data); });
+        if (!synthetic_source_->start(options_.synthetic_rate_hz)) {
+            utils::ErrorHandler::handleSystemError("MasterController",
+                "Synthetic source failed to start - continuing without data source", data::ErrorSeverity::WARNING);
+        }
+        return;
+    }
+
+    // Replay replaces the device entirely
+    if (!options_.replay_path.empty()) {
+        if (!serial_interface_->startReplay(options_.replay_path, options_.replay_speed)) {
+            utils::ErrorHandler::handleSystemError("MasterController",
+                "Replay failed to start - continuing without data source", data::ErrorSeverity::WARNING);
+        }
+        return;
+    }
+
+    if (!options_.capture_path.empty() && !serial_interface_->enableCapture(options_.capture_path)) {
+        utils::ErrorHandler::handleSystemError("MasterController",
+            "Capture file unavailable - continuing without capture", data::ErrorSeverity::WARNING);
+    }
+
+    // Use explicit port if given, otherwise auto-detect Arduino port
+    const std::string detected_port = options_.serial_port.empty()
+        ? serial::SerialInterface::autoDetectArduinoPort()
+        : options_.serial_port;
+    if (detected_port.empty()) {
+        SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ No Arduino detected - running in demo mode (--synthetic <rate> generates data)");
+        utils::ErrorHandler::handleSystemError("MasterController",
+            "Arduino port auto-detection failed - continuing without hardware", data::ErrorSeverity::WARNING);
+        // Don't return false - continue without Arduino
+    } else {
+        // Initialize and start serial communication
+        if (!serial_interface_->initialize(detected_port)) {
+            SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Arduino initialization failed - running in demo mode");
+            utils::ErrorHandler::handleSystemError("MasterController",
+                "SerialInterface initialization failed - continuing without hardware", data::ErrorSeverity::WARNING);
+        } else if (!serial_interface_->start()) {
+            SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Arduino start failed - running in demo mode");
+            utils::ErrorHandler::handleSystemError("MasterController",
+                "SerialInterface start failed - continuing without hardware", data::ErrorSeverity::WARNING);
+        } else {
+            SIREN_LOG_INFO(COMPONENT_NAME, "✅ SerialInterface initialized on port: " << detected_port);
+        }
+    }
+}
+
 void MasterController::setupPeriodicTasks() {
-    std::cout << "[MasterController] Periodic tasks configured - Military-grade monitoring active" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Periodic tasks configured - Military-grade monitoring active");
 }
 
 void MasterController::onHeartbeat(const boost::system::error_code& error) {
@@ -313,6 +358,24 @@ void MasterController::onHeartbeat(const boost::system::error_code& error) {
     // Record heartbeat message
     performance_monitor_->recordMessage();
 
+    // Close the latency interval: histograms -> sliding percentile windows
+    const uint64_t slow_handlers = performance_monitor_->updateLatencyWindows();
+    if (slow_handlers > 0) {
+        SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ High latency detected: " << slow_handlers
+                                          << " handler(s) above " << cnst::performance::timing::MAX_LATENCY_US
+                                          << "μs (p99.9 " << performance_monitor_->getCurrentMetrics().processing_latency.p999_us
+                                          << "μs)");
+    }
+
+    // Publish metrics (with latency percentiles) to clients once per interval
+    if (websocket_server_ && websocket_server_->isRunning()) {
+        performance_monitor_->updateActiveConnections(
+            static_cast<uint16_t>(websocket_server_->getActiveConnections()));
+        performance_monitor_->updateClientQueues(websocket_server_->getQueueStatistics(),
+                                                 websocket_server_->getSessionQueueStatistics());
+        websocket_server_->broadcastPerformanceMetrics(performance_monitor_->getCurrentMetrics());
+    }
+
     // Schedule next heartbeat
     heartbeat_timer_->expires_after(std::chrono::seconds(1));
     heartbeat_timer_->async_wait(
@@ -321,17 +384,36 @@ void MasterController::onHeartbeat(const boost::system::error_code& error) {
         });
 }
 
+void MasterController::runEventLoop() {
+    // A throwing handler must not take its thread out of the pool
+    while (true) {
+        try {
+            io_context_->run();
+            return; // Stopped
+        } catch (const std::exception& e) {
+            utils::ErrorHandler::handleException("MasterController", "event loop processing", e, data::ErrorSeverity::ERROR);
+        }
+    }
+}
+
 // handleSystemError method removed - now using centralized ErrorHandler utility
 
 void MasterController::cleanup() {
-    std::cout << "[MasterController] 🧹 Cleaning up resources..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "🧹 Cleaning up resources...");
 
-    // Stop serial interface
+    // Stop data sources
+    if (synthetic_source_) {
+        synthetic_source_->stop();
+        synthetic_source_.reset();
+    }
     if (serial_interface_) {
         serial_interface_->stop();
         serial_interface_.reset();
     }
 
+    // Drop any partial batch before the server goes away
+    sweep_batcher_.reset();
+
     // Stop WebSocket server
     if (websocket_server_) {
         websocket_server_->stop();
@@ -345,17 +427,18 @@ void MasterController::cleanup() {
 
     // Reset components
     heartbeat_timer_.reset();
+    shutdown_signals_.reset();
     io_context_.reset();
 
-    std::cout << "[MasterController] ✅ Cleanup complete" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "✅ Cleanup complete");
 }
 
 void MasterController::onStateChange(SystemStateManager::SystemState old_state,
                                     SystemStateManager::SystemState new_state) {
     // Coordination logic for state changes
-    std::cout << "[MasterController] Coordinating state change: "
-              << SystemStateManager::stateToString(old_state) << " → "
-              << SystemStateManager::stateToString(new_state) << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Coordinating state change: "
+                                   << SystemStateManager::stateToString(old_state) << " → "
+                                   << SystemStateManager::stateToString(new_state));
 }
 
 void MasterController::onMetricsUpdate(const data::PerformanceMetrics& metrics) {
@@ -368,13 +451,35 @@ void MasterController::onSonarData(const data::SonarDataPoint& sonar_data) {
     // Handle incoming sonar data from SerialInterface
     performance_monitor_->recordMessage();
 
-    // Log sonar data (for VS-1 testing)
-    std::cout << "[MasterController] Sonar data: Angle=" << sonar_data.angle
-              << "°, Distance=" << sonar_data.distance << "cm" << std::endl;
+    // Per-sample trace (enable with --log-level debug)
+    SIREN_LOG_DEBUG(COMPONENT_NAME, "Sonar data: Angle=" << sonar_data.angle
+                                    << "°, Distance=" << sonar_data.distance << "cm");
+
+    // One sequence number per sample, shared by point, batch and replay delivery
+    data::SonarDataPoint sequenced = sonar_data;
+    sequenced.sequence = ++sample_sequence_;
+    if (sequenced.sequence == 0) {
+        sequenced.sequence = ++sample_sequence_; // 0 means unassigned; skip it on wrap
+    }
+
+    // Forward to WebSocket server: per-point clients now, per-batch clients on flush
+    if (websocket_server_ && websocket_server_->isRunning()) {
+        websocket_server_->broadcastSonarData(sequenced);
+    }
+    if (sweep_batcher_) {
+        sweep_batcher_->addPoint(sequenced);
+    }
+}
+
+void MasterController::onEnvironmentData(const data::EnvironmentalData& environment) {
+    // Handle new environmental reading from SerialInterface (already de-duplicated)
+    SIREN_LOG_INFO(COMPONENT_NAME, "Environment: Temp=" << environment.temperature_c
+                                   << "°C, Humidity=" << environment.humidity_percent
+                                   << "%, SoundSpeed=" << environment.sound_speed_cm_per_us << "cm/μs");
 
     // Forward to WebSocket server
     if (websocket_server_ && websocket_server_->isRunning()) {
-        websocket_server_->broadcastSonarData(sonar_data);
+        websocket_server_->broadcastEnvironmentData(environment);
     }
 }
 
@@ -385,6 +490,9 @@ void MasterController::onSerialError(const std::string& error_message, data::Err
     // Update system state on critical errors
     if (severity == data::ErrorSeverity::CRITICAL || severity == data::ErrorSeverity::FATAL) {
         state_manager_->updateState(SystemStateManager::SystemState::ERROR);
+        if (io_context_) {
+            io_context_->stop();
+        }
     }
 }
 
@@ -8,12 +8,18 @@
 #include "core/performance_monitor.hpp"
 #include "constants/performance.hpp"
 #include "utils/statistics_calculator.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
+#include <algorithm>
 
 namespace siren::core {
 
 namespace constants = siren::constants;
 
+// SSOT for log component name (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr const char* COMPONENT_NAME = "PerformanceMonitor";
+}
+
 PerformanceMonitor::PerformanceMonitor()
     : current_metrics_{}
     , start_time_(std::chrono::steady_clock::now())
@@ -25,14 +31,14 @@ PerformanceMonitor::PerformanceMonitor()
     , memory_calculator_(siren::utils::performance_stats::createMemoryUsageCalculator())
     , monitoring_(false)
 {
-    std::cout << "[PerformanceMonitor] Initializing military-grade performance monitoring with StatisticsCalculator..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing military-grade performance monitoring with StatisticsCalculator...");
 }
 
 void PerformanceMonitor::start() {
     std::lock_guard<std::mutex> lock(metrics_mutex_);
 
     if (monitoring_) {
-        std::cout << "[PerformanceMonitor] ⚠️ Already monitoring" << std::endl;
+        SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Already monitoring");
         return;
     }
 
@@ -45,7 +51,7 @@ void PerformanceMonitor::start() {
     total_messages_ = 0;
     messages_since_last_update_ = 0;
 
-    std::cout << "[PerformanceMonitor] ✅ Performance monitoring started" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "✅ Performance monitoring started");
 }
 
 void PerformanceMonitor::stop() {
@@ -56,24 +62,38 @@ void PerformanceMonitor::stop() {
     }
 
     monitoring_ = false;
-    std::cout << "[PerformanceMonitor] 🛑 Performance monitoring stopped" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "🛑 Performance monitoring stopped");
 }
 
-void PerformanceMonitor::recordProcessingTime(uint64_t processing_time_us) {
+uint64_t PerformanceMonitor::updateLatencyWindows() {
     std::lock_guard<std::mutex> lock(metrics_mutex_);
 
+    auto& processing = processing_window_.beginInterval();
+    utils::LatencyTracker::drainInto(utils::LatencyChannel::HANDLER, processing);
+    utils::LatencyTracker::drainInto(utils::LatencyChannel::SERIAL_TO_BROADCAST,
+                                     serial_to_broadcast_window_.beginInterval());
+    utils::LatencyTracker::drainInto(utils::LatencyChannel::SESSION_WRITE,
+                                     session_write_window_.beginInterval());
+
     if (!monitoring_) {
-        return;
+        return 0;
     }
 
-    // Use StatisticsCalculator instead of duplicate moving average calculation
-    auto latency_stats = latency_calculator_.addSample(static_cast<uint32_t>(processing_time_us));
-
-    // Update metrics from statistics calculator
-    current_metrics_.avg_latency_us = latency_stats.exponential_average;
-    current_metrics_.max_latency_us = latency_stats.maximum_value;
+    current_metrics_.processing_latency = processing_window_.summarize();
+    current_metrics_.serial_to_broadcast_latency = serial_to_broadcast_window_.summarize();
+    current_metrics_.session_write_latency = session_write_window_.summarize();
+
+    // Smooth the per-interval mean; keep the worst single handler ever seen
+    if (processing.getCount() > 0) {
+        const auto interval_average = static_cast<uint32_t>(processing.getTotal() / processing.getCount());
+        auto latency_stats = latency_calculator_.addSample(interval_average);
+        current_metrics_.avg_latency_us = latency_stats.exponential_average;
+        current_metrics_.max_latency_us = std::max(current_metrics_.max_latency_us,
+                                                   static_cast<uint32_t>(processing.getMax()));
+    }
 
     updateCalculatedMetrics();
+    return processing.countAbove(constants::performance::timing::MAX_LATENCY_US);
 }
 
 void PerformanceMonitor::recordMessage() {
@@ -95,6 +115,14 @@ void PerformanceMonitor::updateActiveConnections(uint16_t count) {
     updateCalculatedMetrics();
 }
 
+void PerformanceMonitor::updateClientQueues(const data::QueueStatistics& statistics,
+                                            std::vector<data::SessionQueueStatistics> sessions) {
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+    current_metrics_.client_queues = statistics;
+    current_metrics_.session_queues = std::move(sessions);
+    updateCalculatedMetrics();
+}
+
 void PerformanceMonitor::updateSerialStatus(data::SerialStatus status) {
     std::lock_guard<std::mutex> lock(metrics_mutex_);
     current_metrics_.serial_status = status;
@@ -119,12 +147,15 @@ void PerformanceMonitor::resetMetrics() {
     start_time_ = std::chrono::steady_clock::now();
     last_update_ = start_time_;
 
-    // Reset statistics calculators
+    // Reset statistics calculators and latency windows
+    processing_window_.reset();
+    serial_to_broadcast_window_.reset();
+    session_write_window_.reset();
     latency_calculator_.reset();
     throughput_calculator_.reset();
     memory_calculator_.reset();
 
-    std::cout << "[PerformanceMonitor] 🔄 Metrics and statistics calculators reset" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "🔄 Metrics and statistics calculators reset");
 }
 
 void PerformanceMonitor::updateCalculatedMetrics() {
@@ -160,6 +191,7 @@ void PerformanceMonitor::updateMemoryUsage() {
     size_t estimated_usage =
         sizeof(data::PerformanceMetrics) +
         (current_metrics_.active_connections * constants::performance::memory::ESTIMATED_CONNECTION_MEMORY_BYTES) +
+        current_metrics_.client_queues.bytes_queued +
         constants::performance::memory::BASE_USAGE_BYTES;
 
     current_metrics_.memory_usage_bytes = estimated_usage;
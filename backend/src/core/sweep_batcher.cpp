@@ -0,0 +1,106 @@
+/**
+ * @file sweep_batcher.cpp
+ * @brief Implementation of sweep-aware sonar point batching
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "core/sweep_batcher.hpp"
+#include "utils/error_handler.hpp"
+#include "utils/logger.hpp"
+#include "utils/latency_tracker.hpp"
+#include <algorithm>
+
+namespace siren::core {
+
+// SSOT for log component name (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr const char* COMPONENT_NAME = "SweepBatcher";
+}
+
+SweepBatcher::SweepBatcher(boost::asio::io_context& io_context,
+                           size_t max_points,
+                           std::chrono::microseconds max_delay)
+    : strand_(boost::asio::make_strand(io_context))
+    , flush_timer_(strand_)
+    , max_points_(std::max<size_t>(1, max_points))
+    , max_delay_(max_delay)
+    , pending_()
+    , sweep_tracker_()
+    , batch_generation_(0)
+    , batch_callback_(nullptr)
+{
+    pending_.points.reserve(max_points_);
+
+    SIREN_LOG_INFO(COMPONENT_NAME, "Batching up to " << max_points_ << " points or "
+                                   << max_delay_.count() << "μs per frame, flushing at sweep boundaries");
+}
+
+void SweepBatcher::setBatchCallback(BatchCallback callback) {
+    batch_callback_ = std::move(callback);
+}
+
+void SweepBatcher::addPoint(const data::SonarDataPoint& point) {
+    boost::asio::post(strand_,
+        [this, point]() {
+            utils::ScopedHandlerTimer timer;
+            onPoint(point);
+        });
+}
+
+void SweepBatcher::onPoint(const data::SonarDataPoint& point) {
+    // A reversal closes the previous sweep; this point opens the next one
+    if (sweep_tracker_.update(point.angle) && !pending_.points.empty()) {
+        flush(true);
+    }
+
+    const bool starts_batch = pending_.points.empty();
+    if (starts_batch) {
+        pending_.sweep_count = sweep_tracker_.getState().sweep_count;
+    }
+    pending_.points.push_back(point);
+
+    if (pending_.points.size() >= max_points_) {
+        flush(false);
+    } else if (starts_batch) {
+        // Re-arming cancels any wait left over from the previous batch
+        const uint64_t generation = batch_generation_;
+        flush_timer_.expires_after(max_delay_);
+        flush_timer_.async_wait(
+            [this, generation](const boost::system::error_code& error) {
+                utils::ScopedHandlerTimer timer;
+                onFlushTimer(error, generation);
+            });
+    }
+}
+
+void SweepBatcher::onFlushTimer(const boost::system::error_code& error, uint64_t generation) {
+    // Aborted by re-arming, or the batch was already flushed by size/sweep
+    if (error || generation != batch_generation_ || pending_.points.empty()) {
+        return;
+    }
+
+    flush(false);
+}
+
+void SweepBatcher::flush(bool sweep_complete) {
+    data::SonarBatch batch;
+    batch.points.reserve(max_points_);
+    std::swap(batch, pending_);
+    batch.sweep_complete = sweep_complete;
+    ++batch_generation_;
+
+    SIREN_LOG_DEBUG(COMPONENT_NAME, "Batch of " << batch.points.size() << " points (sweep "
+                                    << batch.sweep_count << (sweep_complete ? ", complete)" : ")"));
+
+    if (batch_callback_) {
+        try {
+            batch_callback_(batch);
+        } catch (const std::exception& e) {
+            utils::ErrorHandler::handleException(COMPONENT_NAME, "batch callback", e,
+                                               data::ErrorSeverity::ERROR);
+        }
+    }
+}
+
+} // namespace siren::core
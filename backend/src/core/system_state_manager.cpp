@@ -6,10 +6,15 @@
  */
 
 #include "core/system_state_manager.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
 
 namespace siren::core {
 
+// SSOT for log component name (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr const char* COMPONENT_NAME = "SystemStateManager";
+}
+
 SystemStateManager::SystemStateManager(SystemState initial_state)
     : current_state_(initial_state)
 {
@@ -24,15 +29,15 @@ bool SystemStateManager::updateState(SystemState new_state) {
 
     // Validate transition
     if (!isValidTransition(old_state, new_state)) {
-        std::cout << "[SystemStateManager] ❌ Invalid state transition: "
-                  << stateToString(old_state) << " → " << stateToString(new_state) << std::endl;
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Invalid state transition: "
+                                        << stateToString(old_state) << " → " << stateToString(new_state));
         return false;
     }
 
     // Perform atomic state change
     if (current_state_.compare_exchange_strong(old_state, new_state)) {
-        std::cout << "[SystemStateManager] State transition: "
-                  << stateToString(old_state) << " → " << stateToString(new_state) << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "State transition: "
+                                       << stateToString(old_state) << " → " << stateToString(new_state));
 
         // Notify callback if set
         if (state_change_callback_) {
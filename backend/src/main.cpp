@@ -5,7 +5,9 @@
  * @date 2025
  */
 
+#include <cstdlib>
 #include <iostream>
+#include <string>
 #include <thread>
 #include <chrono>
 #include <boost/version.hpp>
@@ -20,8 +22,91 @@
 #include "constants/performance.hpp"
 #include "constants/math.hpp"
 #include "core/master_controller.hpp"
+#include "utils/logger.hpp"
+
+namespace {
+    constexpr const char* COMPONENT_NAME = "Main";
+
+    /// Command line options selecting the serial data source
+    constexpr const char* PORT_OPTION = "--port";
+    constexpr const char* CAPTURE_OPTION = "--capture";
+    constexpr const char* REPLAY_OPTION = "--replay";
+    constexpr const char* REPLAY_SPEED_OPTION = "--replay-speed";
+    constexpr const char* SYNTHETIC_OPTION = "--synthetic";
+    constexpr const char* LOG_LEVEL_OPTION = "--log-level";
+    constexpr const char* THREADS_OPTION = "--threads";
+    constexpr const char* BATCH_POINTS_OPTION = "--batch-points";
+    constexpr const char* BATCH_DELAY_OPTION = "--batch-delay-us";
+    constexpr const char* DELTA_THRESHOLD_OPTION = "--delta-threshold-cm";
+    constexpr const char* DELTA_KEYFRAME_OPTION = "--delta-keyframe-us";
+
+    void printUsage(const char* program) {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  " << PORT_OPTION << " <device>        Serial device (default: auto-detect Arduino)\n"
+                  << "  " << CAPTURE_OPTION << " <file>       Append raw received serial data to file\n"
+                  << "  " << REPLAY_OPTION << " <file>        Replay a capture instead of a serial device\n"
+                  << "  " << REPLAY_SPEED_OPTION << " <x>     Replay speed: 1 = real time, 0 = as fast as possible\n"
+                  << "  " << SYNTHETIC_OPTION << " <rate>    Generate a synthetic scene at rate samples/s ("
+                  << static_cast<uint32_t>(siren::constants::communication::synthetic::MIN_RATE_HZ) << "-"
+                  << static_cast<uint32_t>(siren::constants::communication::synthetic::MAX_RATE_HZ) << ") instead of serial\n"
+                  << "  " << LOG_LEVEL_OPTION << " <level>   debug, info, warning, error, critical or off (default: info)\n"
+                  << "  " << THREADS_OPTION << " <n>            I/O threads (default: "
+                  << static_cast<int>(siren::constants::performance::timing::THREAD_POOL_SIZE) << ")\n"
+                  << "  " << BATCH_POINTS_OPTION << " <n>       Per-batch clients: max points per frame (default: "
+                  << siren::constants::communication::batching::DEFAULT_MAX_POINTS << ")\n"
+                  << "  " << BATCH_DELAY_OPTION << " <us>    Per-batch clients: max frame delay (default: "
+                  << siren::constants::communication::batching::DEFAULT_MAX_DELAY_US << ")\n"
+                  << "  " << DELTA_THRESHOLD_OPTION << " <cm> Delta clients: min distance change sent (default: "
+                  << siren::constants::communication::delta::DEFAULT_THRESHOLD_CM << ")\n"
+                  << "  " << DELTA_KEYFRAME_OPTION << " <us>  Delta clients: resend unchanged angles after (default: "
+                  << siren::constants::communication::delta::DEFAULT_KEYFRAME_INTERVAL_US << ", 0 = never)"
+                  << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    siren::core::ControllerOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = (i + 1 < argc);
+        if (arg == PORT_OPTION && has_value) {
+            options.serial_port = argv[++i];
+        } else if (arg == CAPTURE_OPTION && has_value) {
+            options.capture_path = argv[++i];
+        } else if (arg == REPLAY_OPTION && has_value) {
+            options.replay_path = argv[++i];
+        } else if (arg == REPLAY_SPEED_OPTION && has_value) {
+            options.replay_speed = std::strtod(argv[++i], nullptr);
+        } else if (arg == SYNTHETIC_OPTION && has_value) {
+            options.synthetic_rate_hz = std::strtod(argv[++i], nullptr);
+            if (!(options.synthetic_rate_hz >= siren::constants::communication::synthetic::MIN_RATE_HZ
+                  && options.synthetic_rate_hz <= siren::constants::communication::synthetic::MAX_RATE_HZ)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+        } else if (arg == THREADS_OPTION && has_value) {
+            options.io_threads = static_cast<size_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == BATCH_POINTS_OPTION && has_value) {
+            options.batch_max_points = static_cast<size_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == BATCH_DELAY_OPTION && has_value) {
+            options.batch_max_delay_us = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == DELTA_THRESHOLD_OPTION && has_value) {
+            options.delta_threshold_cm = static_cast<int16_t>(std::strtol(argv[++i], nullptr, 10));
+        } else if (arg == DELTA_KEYFRAME_OPTION && has_value) {
+            options.delta_keyframe_interval_us = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == LOG_LEVEL_OPTION && has_value) {
+            siren::utils::LogLevel level = siren::utils::LogLevel::INFO;
+            if (!siren::utils::Logger::parseLevel(argv[++i], level)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+            siren::utils::Logger::setLevel(level);
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
 
-int main() {
     namespace cnst = siren::constants;
     namespace msg = cnst::message;
     namespace perf = cnst::performance;
@@ -53,34 +138,38 @@ int main() {
     // Test military-grade master controller
     std::cout << "\n=== Phase 2: Military-Grade Master Controller Test ===" << std::endl;
 
-    siren::core::MasterController controller;
+    // Banner above is synchronous; from here on output goes through the async logger
+    siren::utils::Logger::start();
+
+    siren::core::MasterController controller(options);
 
-    std::cout << "Initializing master controller..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing master controller...");
     if (!controller.initialize()) {
-        std::cout << "❌ Controller initialization failed" << std::endl;
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Controller initialization failed");
         return 1;
     }
 
-    std::cout << "Starting controller..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Starting controller...");
     if (!controller.start()) {
-        std::cout << "❌ Controller start failed" << std::endl;
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Controller start failed");
         return 1;
     }
 
-    std::cout << "Controller state: " << static_cast<int>(controller.getSystemState()) << std::endl;
-    std::cout << "System healthy: " << (controller.isHealthy() ? "Yes" : "No") << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Controller state: " << static_cast<int>(controller.getSystemState()));
+    SIREN_LOG_INFO(COMPONENT_NAME, "System healthy: " << (controller.isHealthy() ? "Yes" : "No"));
 
     // Run controller continuously (military-grade production mode)
-    std::cout << "Running controller in production mode - Ctrl+C to stop..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Running controller in production mode - Ctrl+C to stop...");
 
     // Run the controller (this blocks until stop() is called)
     controller.run();
 
     auto metrics = controller.getPerformanceMetrics();
-    std::cout << "Final metrics - Active connections: " << metrics.active_connections << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Final metrics - Active connections: " << metrics.active_connections);
 
-    std::cout << "\n✅ Master controller test complete" << std::endl;
-    std::cout << "✅ Phase 2 Step 1 Complete - Event loop operational" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "✅ Master controller test complete");
+    SIREN_LOG_INFO(COMPONENT_NAME, "✅ Phase 2 Step 1 Complete - Event loop operational");
 
+    siren::utils::Logger::shutdown();
     return 0;
 }
\ No newline at end of file
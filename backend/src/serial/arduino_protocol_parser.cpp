@@ -10,64 +10,299 @@
 #include "serial/arduino_protocol_parser.hpp"
 #include "constants/hardware.hpp"
 #include "constants/performance.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
+#include <array>
 #include <chrono>
+#include <charconv>
 
 namespace siren::serial {
 
 namespace constants = siren::constants;
 
-ArduinoProtocolParser::ArduinoProtocolParser()
+// SSOT for scanner tokens (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr const char* COMPONENT_NAME = "ArduinoProtocolParser";
+    constexpr std::string_view ANGLE_TOKEN{constants::hardware::arduino::ANGLE_TOKEN};
+    constexpr std::string_view DISTANCE_TOKEN{constants::hardware::arduino::DISTANCE_TOKEN};
+    constexpr std::string_view TEMPERATURE_TOKEN{constants::hardware::arduino::TEMPERATURE_TOKEN};
+    constexpr std::string_view HUMIDITY_TOKEN{constants::hardware::arduino::HUMIDITY_TOKEN};
+    constexpr std::string_view SOUND_SPEED_TOKEN{constants::hardware::arduino::SOUND_SPEED_TOKEN};
+    constexpr char FIELD_SEPARATOR = constants::hardware::arduino::FIELD_SEPARATOR;
+    constexpr char DECIMAL_POINT = '.';
+    constexpr char MINUS_SIGN = '-';
+    constexpr double DECIMAL_BASE = 10.0;
+
+    /// Fractional digits kept by scanDecimal; later digits are below float precision
+    constexpr size_t MAX_FRACTION_DIGITS = 15;
+    constexpr std::array<double, MAX_FRACTION_DIGITS + 1> POWERS_OF_TEN = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15
+    };
+
+    /// Regex capture groups of the optional environmental trailer
+    constexpr size_t TEMPERATURE_GROUP = 3;
+    constexpr size_t HUMIDITY_GROUP = 4;
+    constexpr size_t SOUND_SPEED_GROUP = 5;
+
+    /// Matches the regex \s character class
+    constexpr bool isSpace(char c) noexcept {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+    }
+
+    constexpr bool isDigit(char c) noexcept {
+        return c >= '0' && c <= '9';
+    }
+
+    const char* skipSpaces(const char* p, const char* end) noexcept {
+        while (p != end && isSpace(*p)) {
+            ++p;
+        }
+        return p;
+    }
+
+    /// Match \s*-\s*; returns position after it or nullptr
+    const char* expectSeparator(const char* p, const char* end) noexcept {
+        p = skipSpaces(p, end);
+        if (p == end || *p != FIELD_SEPARATOR) {
+            return nullptr;
+        }
+        return skipSpaces(p + 1, end);
+    }
+
+    /// Match token\s*; returns position after it or nullptr
+    const char* expectToken(const char* p, const char* end, std::string_view token) noexcept {
+        if (static_cast<size_t>(end - p) < token.size() ||
+            std::string_view(p, token.size()) != token) {
+            return nullptr;
+        }
+        return skipSpaces(p + token.size(), end);
+    }
+
+    /// Parse \d+ into value; returns one-past-last digit or nullptr on failure
+    const char* scanUnsigned(const char* p, const char* end, int& value) noexcept {
+        if (p == end || !isDigit(*p)) {
+            return nullptr;
+        }
+        const auto [ptr, ec] = std::from_chars(p, end, value);
+        return (ec == std::errc{}) ? ptr : nullptr;
+    }
+
+    /**
+     * Parse -?\d+(\.\d+)? into value; returns one-past-last digit or nullptr.
+     * Hand-rolled because floating-point std::from_chars is not available on
+     * every toolchain we target; firmware emits at most 5 fractional digits.
+     */
+    const char* scanDecimal(const char* p, const char* end, float& value) noexcept {
+        const bool negative = (p != end && *p == MINUS_SIGN);
+        if (negative) {
+            ++p;
+        }
+        if (p == end || !isDigit(*p)) {
+            return nullptr;
+        }
+
+        double result = 0.0;
+        while (p != end && isDigit(*p)) {
+            result = result * DECIMAL_BASE + static_cast<double>(*p - '0');
+            ++p;
+        }
+
+        // Fraction as an integer and one division, not a dependent divide per digit
+        if (p != end && *p == DECIMAL_POINT && (p + 1) != end && isDigit(*(p + 1))) {
+            ++p;
+            uint64_t fraction = 0;
+            size_t fraction_digits = 0;
+            while (p != end && isDigit(*p)) {
+                if (fraction_digits < MAX_FRACTION_DIGITS) {
+                    fraction = fraction * 10U + static_cast<uint64_t>(*p - '0');
+                    ++fraction_digits;
+                }
+                ++p;
+            }
+            result += static_cast<double>(fraction) / POWERS_OF_TEN[fraction_digits];
+        }
+
+        value = static_cast<float>(negative ? -result : result);
+        return p;
+    }
+
+    /// Steady clock in microseconds, the time base of sample timestamps
+    uint64_t steadyNowUs() noexcept {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /// Scan " - Temp: T - Humidity: H[ - SoundSpeed: S]" starting right after the distance digits
+    std::optional<data::EnvironmentalData> scanEnvironmentalTrailer(const char* p, const char* end,
+                                                                    uint64_t receipt_timestamp_us) noexcept {
+        float temperature = 0.0f;
+        float humidity = 0.0f;
+        float sound_speed = 0.0f;
+
+        p = expectSeparator(p, end);
+        p = (p != nullptr) ? expectToken(p, end, TEMPERATURE_TOKEN) : nullptr;
+        p = (p != nullptr) ? scanDecimal(p, end, temperature) : nullptr;
+        p = (p != nullptr) ? expectSeparator(p, end) : nullptr;
+        p = (p != nullptr) ? expectToken(p, end, HUMIDITY_TOKEN) : nullptr;
+        p = (p != nullptr) ? scanDecimal(p, end, humidity) : nullptr;
+        if (p == nullptr) {
+            return std::nullopt;
+        }
+
+        // SoundSpeed is optional (sendEnhancedSonarData omits it)
+        const char* q = expectSeparator(p, end);
+        q = (q != nullptr) ? expectToken(q, end, SOUND_SPEED_TOKEN) : nullptr;
+        if (q == nullptr || scanDecimal(q, end, sound_speed) == nullptr) {
+            sound_speed = 0.0f;
+        }
+
+        return data::EnvironmentalData(temperature, humidity, sound_speed, receipt_timestamp_us);
+    }
+}
+
+ArduinoProtocolParser::ArduinoProtocolParser(ParseMode mode)
     : pattern_(constants::hardware::arduino::DATA_FORMAT_REGEX)
+    , mode_(mode)
 {
-    std::cout << "[ArduinoProtocolParser] Initializing military-grade Arduino protocol parser..." << std::endl;
-    std::cout << "[ArduinoProtocolParser] ✅ Parser initialized with regex pattern" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing military-grade Arduino protocol parser...");
+    SIREN_LOG_INFO(COMPONENT_NAME, "✅ Parser initialized ("
+                                   << (mode_ == ParseMode::SCANNER ? "scanner" : "regex") << " mode)");
 }
 
-std::optional<data::SonarDataPoint> ArduinoProtocolParser::parseSonarData(const std::string& message) {
-    auto parsing_start = std::chrono::steady_clock::now();
+std::optional<data::SonarDataPoint> ArduinoProtocolParser::parseSonarData(std::string_view message) {
+    std::optional<data::EnvironmentalData> environment;
+    return parseSonarData(message, environment, steadyNowUs());
+}
 
-    try {
-        // Expected format: "Angle: X - Distance: Y"
-        std::smatch matches;
+std::optional<data::SonarDataPoint> ArduinoProtocolParser::parseSonarData(
+    std::string_view message, std::optional<data::EnvironmentalData>& environment) {
+    return parseSonarData(message, environment, steadyNowUs());
+}
 
-        if (std::regex_search(message, matches, pattern_)) {
-            int angle = std::stoi(matches[1].str());
-            int distance = std::stoi(matches[2].str());
+std::optional<data::SonarDataPoint> ArduinoProtocolParser::parseSonarData(
+    std::string_view message, std::optional<data::EnvironmentalData>& environment,
+    uint64_t receipt_timestamp_us) {
+    // Two clock reads cost more than scanning the line, so only every Nth message is timed
+    std::optional<std::chrono::steady_clock::time_point> parsing_start;
+    if (statistics_.total_messages_processed % constants::performance::optimization::PARSE_TIMING_SAMPLE_INTERVAL == 0) {
+        parsing_start = std::chrono::steady_clock::now();
+    }
+    environment.reset();
+
+    try {
+        // Expected format: "Angle: X - Distance: Y[ - Temp: T - Humidity: H - SoundSpeed: S]"
+        int angle = 0;
+        int distance = 0;
 
-            data::SonarDataPoint point(angle, distance);
+        const bool matched = (mode_ == ParseMode::SCANNER)
+            ? scanSonarFields(message, angle, distance, environment, receipt_timestamp_us)
+            : matchSonarFields(message, angle, distance, environment, receipt_timestamp_us);
 
-            // Calculate parsing time
-            auto parsing_time = std::chrono::duration_cast<std::chrono::microseconds>(
-                std::chrono::steady_clock::now() - parsing_start).count();
+        if (matched) {
+            data::SonarDataPoint point(static_cast<int16_t>(angle), static_cast<int16_t>(distance),
+                                       data::SonarDataPoint::FULL_QUALITY, receipt_timestamp_us);
 
             if (validateHardwareConstraints(point)) {
-                updateStatistics(static_cast<uint32_t>(parsing_time), true, true);
+                if (environment.has_value()) {
+                    if (validateEnvironmentalConstraints(*environment)) {
+                        statistics_.environmental_samples++;
+                    } else {
+                        statistics_.environmental_rejections++;
+                        environment.reset();
+                    }
+                }
+                updateStatistics(parsing_start, true, true);
                 return point;
             } else {
-                std::cout << "[ArduinoProtocolParser] ⚠️ Invalid sonar data: angle="
-                          << angle << "°, distance=" << distance << "cm" << std::endl;
-                updateStatistics(static_cast<uint32_t>(parsing_time), true, false);
+                SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Invalid sonar data: angle="
+                                                  << angle << "°, distance=" << distance << "cm");
+                updateStatistics(parsing_start, true, false);
+                environment.reset();
             }
         } else {
-            std::cout << "[ArduinoProtocolParser] ⚠️ Failed to parse message: " << message << std::endl;
-
-            auto parsing_time = std::chrono::duration_cast<std::chrono::microseconds>(
-                std::chrono::steady_clock::now() - parsing_start).count();
-            updateStatistics(static_cast<uint32_t>(parsing_time), false, false);
+            SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Failed to parse message: " << message);
+            updateStatistics(parsing_start, false, false);
         }
 
     } catch (const std::exception& e) {
-        std::cout << "[ArduinoProtocolParser] ❌ Parse exception: " << e.what() << std::endl;
-
-        auto parsing_time = std::chrono::duration_cast<std::chrono::microseconds>(
-            std::chrono::steady_clock::now() - parsing_start).count();
-        updateStatistics(static_cast<uint32_t>(parsing_time), false, false);
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Parse exception: " << e.what());
+        updateStatistics(parsing_start, false, false);
+        environment.reset();
     }
 
     return std::nullopt;
 }
 
+bool ArduinoProtocolParser::scanSonarFields(std::string_view message, int& angle, int& distance) noexcept {
+    std::optional<data::EnvironmentalData> environment;
+    return scanSonarFields(message, angle, distance, environment);
+}
+
+bool ArduinoProtocolParser::scanSonarFields(std::string_view message, int& angle, int& distance,
+                                            std::optional<data::EnvironmentalData>& environment) noexcept {
+    return scanSonarFields(message, angle, distance, environment, steadyNowUs());
+}
+
+bool ArduinoProtocolParser::scanSonarFields(std::string_view message, int& angle, int& distance,
+                                            std::optional<data::EnvironmentalData>& environment,
+                                            uint64_t receipt_timestamp_us) noexcept {
+    const char* const end = message.data() + message.size();
+    size_t search_from = 0;
+
+    // Same semantics as regex_search: try every "Angle:" occurrence in turn
+    size_t token_pos = 0;
+    while ((token_pos = message.find(ANGLE_TOKEN, search_from)) != std::string_view::npos) {
+        search_from = token_pos + 1;
+
+        const char* p = skipSpaces(message.data() + token_pos + ANGLE_TOKEN.size(), end);
+        p = scanUnsigned(p, end, angle);
+        p = (p != nullptr) ? expectSeparator(p, end) : nullptr;
+        p = (p != nullptr) ? expectToken(p, end, DISTANCE_TOKEN) : nullptr;
+        p = (p != nullptr) ? scanUnsigned(p, end, distance) : nullptr;
+
+        if (p != nullptr) {
+            // Continue the same pass into the optional environmental trailer
+            environment = scanEnvironmentalTrailer(p, end, receipt_timestamp_us);
+            return true;
+        }
+    }
+
+    environment.reset();
+    return false;
+}
+
+bool ArduinoProtocolParser::matchSonarFields(std::string_view message, int& angle, int& distance,
+                                             std::optional<data::EnvironmentalData>& environment,
+                                             uint64_t receipt_timestamp_us) const {
+    std::cmatch matches;
+
+    if (!std::regex_search(message.data(), message.data() + message.size(), matches, pattern_)) {
+        return false;
+    }
+
+    angle = std::stoi(matches[1].str());
+    distance = std::stoi(matches[2].str());
+
+    if (matches[TEMPERATURE_GROUP].matched && matches[HUMIDITY_GROUP].matched) {
+        const float sound_speed = matches[SOUND_SPEED_GROUP].matched
+            ? std::stof(matches[SOUND_SPEED_GROUP].str()) : 0.0f;
+        environment = data::EnvironmentalData(std::stof(matches[TEMPERATURE_GROUP].str()),
+                                              std::stof(matches[HUMIDITY_GROUP].str()),
+                                              sound_speed, receipt_timestamp_us);
+    } else {
+        environment.reset();
+    }
+
+    return true;
+}
+
+void ArduinoProtocolParser::setParseMode(ParseMode mode) noexcept {
+    mode_ = mode;
+}
+
+ArduinoProtocolParser::ParseMode ArduinoProtocolParser::getParseMode() const noexcept {
+    return mode_;
+}
+
 bool ArduinoProtocolParser::validateHardwareConstraints(const data::SonarDataPoint& data_point) const {
     // Validate angle range against SG90 servo specifications
     if (data_point.angle < constants::hardware::servo::MIN_ANGLE_DEGREES ||
@@ -84,16 +319,32 @@ bool ArduinoProtocolParser::validateHardwareConstraints(const data::SonarDataPoi
     return true;
 }
 
+bool ArduinoProtocolParser::validateEnvironmentalConstraints(const data::EnvironmentalData& environment) const {
+    // Validate against DHT11 measurement range
+    if (environment.temperature_c < constants::hardware::environment::MIN_TEMPERATURE_C ||
+        environment.temperature_c > constants::hardware::environment::MAX_TEMPERATURE_C) {
+        return false;
+    }
+
+    if (environment.humidity_percent < constants::hardware::environment::MIN_HUMIDITY_PERCENT ||
+        environment.humidity_percent > constants::hardware::environment::MAX_HUMIDITY_PERCENT) {
+        return false;
+    }
+
+    return environment.sound_speed_cm_per_us >= 0.0f;
+}
+
 ArduinoProtocolParser::ParsingStatistics ArduinoProtocolParser::getStatistics() const {
     return statistics_;
 }
 
 void ArduinoProtocolParser::resetStatistics() {
     statistics_ = ParsingStatistics{};
-    std::cout << "[ArduinoProtocolParser] 📊 Statistics reset" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "📊 Statistics reset");
 }
 
-void ArduinoProtocolParser::updateStatistics(uint32_t parsing_time_us, bool parse_successful, bool validation_passed) const {
+void ArduinoProtocolParser::updateStatistics(const std::optional<std::chrono::steady_clock::time_point>& parsing_start,
+                                             bool parse_successful, bool validation_passed) const {
     statistics_.total_messages_processed++;
 
     if (parse_successful) {
@@ -108,6 +359,12 @@ void ArduinoProtocolParser::updateStatistics(uint32_t parsing_time_us, bool pars
         statistics_.failed_parses++;
     }
 
+    if (!parsing_start.has_value()) {
+        return;
+    }
+    const auto parsing_time_us = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - *parsing_start).count());
+
     // Update average parsing time using exponential moving average
     if (statistics_.avg_parsing_time_us == 0) {
         statistics_.avg_parsing_time_us = parsing_time_us;
@@ -0,0 +1,156 @@
+/**
+ * @file binary_frame_decoder.cpp
+ * @brief Implementation of the COBS-framed binary Arduino protocol decoder
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Allocation-free frame decoding with CRC16 integrity checking.
+ */
+
+#include "serial/binary_frame_decoder.hpp"
+#include "constants/hardware.hpp"
+#include <array>
+
+namespace siren::serial {
+
+namespace constants = siren::constants;
+
+// SSOT for frame layout (MISRA C++ Rule 5.0.1)
+namespace {
+    namespace frame = constants::hardware::arduino::binary_frame;
+
+    constexpr uint8_t COBS_MAX_BLOCK = 0xFF;
+    constexpr uint16_t CRC_TOP_BIT = 0x8000;
+    constexpr unsigned BITS_PER_BYTE = 8;
+
+    /// Payload byte offsets
+    constexpr size_t VERSION_OFFSET = 0;
+    constexpr size_t FLAGS_OFFSET = 1;
+    constexpr size_t ANGLE_OFFSET = 2;
+    constexpr size_t DISTANCE_OFFSET = 3;
+    constexpr size_t TIMESTAMP_OFFSET = 5;
+    constexpr size_t TEMPERATURE_OFFSET = 9;
+    constexpr size_t HUMIDITY_OFFSET = 11;
+    constexpr size_t SOUND_SPEED_OFFSET = 13;
+
+    constexpr uint16_t readU16(const uint8_t* p) noexcept {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    constexpr uint32_t readU32(const uint8_t* p) noexcept {
+        return static_cast<uint32_t>(p[0]) |
+               (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) |
+               (static_cast<uint32_t>(p[3]) << 24);
+    }
+}
+
+BinaryFrameDecoder::BinaryFrameDecoder(const ArduinoProtocolParser& validator)
+    : validator_(validator)
+{
+}
+
+std::optional<BinaryFrameDecoder::DecodedFrame> BinaryFrameDecoder::decodeFrame(std::string_view encoded,
+                                                                                  uint64_t receipt_timestamp_us) {
+    std::array<uint8_t, frame::MAX_PAYLOAD_SIZE + frame::CRC_SIZE> decoded{};
+
+    const size_t size = cobsDecode(reinterpret_cast<const uint8_t*>(encoded.data()), encoded.size(),
+                                   decoded.data(), decoded.size());
+
+    // Length must match exactly one of the two layouts
+    if (size != frame::BASE_PAYLOAD_SIZE + frame::CRC_SIZE &&
+        size != frame::MAX_PAYLOAD_SIZE + frame::CRC_SIZE) {
+        statistics_.framing_errors++;
+        return std::nullopt;
+    }
+
+    const size_t payload_size = size - frame::CRC_SIZE;
+    if (crc16(decoded.data(), payload_size) != readU16(decoded.data() + payload_size)) {
+        statistics_.crc_errors++;
+        return std::nullopt;
+    }
+
+    const bool has_environment = (decoded[FLAGS_OFFSET] & frame::FLAG_ENVIRONMENT) != 0;
+    if (decoded[VERSION_OFFSET] != frame::VERSION ||
+        has_environment != (payload_size == frame::MAX_PAYLOAD_SIZE)) {
+        statistics_.framing_errors++;
+        return std::nullopt;
+    }
+
+    DecodedFrame result{data::SonarDataPoint(static_cast<int16_t>(decoded[ANGLE_OFFSET]),
+                                             static_cast<int16_t>(readU16(decoded.data() + DISTANCE_OFFSET)),
+                                             data::SonarDataPoint::FULL_QUALITY, receipt_timestamp_us),
+                        std::nullopt};
+    result.point.device_timestamp_us = readU32(decoded.data() + TIMESTAMP_OFFSET);
+
+    if (!validator_.validateHardwareConstraints(result.point)) {
+        statistics_.validation_failures++;
+        return std::nullopt;
+    }
+
+    if (has_environment) {
+        const auto temperature = static_cast<int16_t>(readU16(decoded.data() + TEMPERATURE_OFFSET));
+        data::EnvironmentalData environment(
+            static_cast<float>(temperature) / frame::TEMPERATURE_SCALE,
+            static_cast<float>(readU16(decoded.data() + HUMIDITY_OFFSET)) / frame::HUMIDITY_SCALE,
+            static_cast<float>(readU16(decoded.data() + SOUND_SPEED_OFFSET)) / frame::SOUND_SPEED_SCALE,
+            receipt_timestamp_us);
+
+        if (validator_.validateEnvironmentalConstraints(environment)) {
+            result.environment = environment;
+        }
+    }
+
+    statistics_.frames_decoded++;
+    return result;
+}
+
+size_t BinaryFrameDecoder::cobsDecode(const uint8_t* input, size_t input_size,
+                                      uint8_t* output, size_t output_capacity) noexcept {
+    size_t read = 0;
+    size_t written = 0;
+
+    while (read < input_size) {
+        const uint8_t code = input[read++];
+        if (code == frame::DELIMITER) {
+            return 0; // Delimiter inside frame
+        }
+
+        for (uint8_t i = 1; i < code; ++i) {
+            if (read >= input_size || written >= output_capacity || input[read] == frame::DELIMITER) {
+                return 0;
+            }
+            output[written++] = input[read++];
+        }
+
+        // Implicit zero after every block except a full block or the last one
+        if (code != COBS_MAX_BLOCK && read < input_size) {
+            if (written >= output_capacity) {
+                return 0;
+            }
+            output[written++] = 0;
+        }
+    }
+
+    return written;
+}
+
+uint16_t BinaryFrameDecoder::crc16(const uint8_t* data, size_t size) noexcept {
+    uint16_t crc = frame::CRC_INITIAL;
+
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= static_cast<uint16_t>(data[i] << BITS_PER_BYTE);
+        for (unsigned bit = 0; bit < BITS_PER_BYTE; ++bit) {
+            crc = (crc & CRC_TOP_BIT) ? static_cast<uint16_t>((crc << 1) ^ frame::CRC_POLYNOMIAL)
+                                      : static_cast<uint16_t>(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+BinaryFrameDecoder::DecoderStatistics BinaryFrameDecoder::getStatistics() const noexcept {
+    return statistics_;
+}
+
+} // namespace siren::serial
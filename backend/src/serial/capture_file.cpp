@@ -0,0 +1,190 @@
+/**
+ * @file capture_file.cpp
+ * @brief Implementation of raw serial capture and memory-mapped replay files
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * POSIX file I/O: O_APPEND + writev for capture, mmap for replay.
+ */
+
+#include "serial/capture_file.hpp"
+#include "constants/communication.hpp"
+#include "utils/logger.hpp"
+#include <array>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace siren::serial {
+
+namespace constants = siren::constants;
+
+// SSOT for file layout (MISRA C++ Rule 5.0.1)
+namespace {
+    namespace capture = constants::communication::capture;
+
+    constexpr const char* COMPONENT_NAME = "CaptureFile";
+    constexpr mode_t FILE_PERMISSIONS = 0644;
+    constexpr int NO_FD = -1;
+}
+
+CaptureWriter::CaptureWriter()
+    : fd_(NO_FD)
+{
+}
+
+CaptureWriter::~CaptureWriter() {
+    close();
+}
+
+bool CaptureWriter::open(const std::string& path) {
+    close();
+
+    fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, FILE_PERMISSIONS);
+    if (fd_ < 0) {
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Cannot open capture file " << path
+                                        << ": " << std::strerror(errno));
+        fd_ = NO_FD;
+        return false;
+    }
+
+    // New file: write header so readers can validate it
+    struct stat info{};
+    if (::fstat(fd_, &info) == 0 && info.st_size == 0) {
+        std::array<char, capture::FILE_HEADER_SIZE> header{};
+        std::memcpy(header.data(), capture::MAGIC, capture::MAGIC_SIZE);
+        std::memcpy(header.data() + capture::MAGIC_SIZE, &capture::VERSION, sizeof(capture::VERSION));
+
+        if (::write(fd_, header.data(), header.size()) != static_cast<ssize_t>(header.size())) {
+            close();
+            return false;
+        }
+    }
+
+    SIREN_LOG_INFO(COMPONENT_NAME, "💾 Capturing raw serial data to " << path);
+    return true;
+}
+
+bool CaptureWriter::write(uint64_t timestamp_ns, const char* data, size_t size) noexcept {
+    if (fd_ == NO_FD) {
+        return false;
+    }
+
+    std::array<char, capture::RECORD_HEADER_SIZE> header{};
+    const auto length = static_cast<uint32_t>(size);
+    std::memcpy(header.data(), &timestamp_ns, sizeof(timestamp_ns));
+    std::memcpy(header.data() + sizeof(timestamp_ns), &length, sizeof(length));
+
+    std::array<iovec, 2> parts{{
+        {header.data(), header.size()},
+        {const_cast<char*>(data), size}
+    }};
+
+    const ssize_t expected = static_cast<ssize_t>(header.size() + size);
+    return ::writev(fd_, parts.data(), static_cast<int>(parts.size())) == expected;
+}
+
+void CaptureWriter::close() noexcept {
+    if (fd_ != NO_FD) {
+        ::close(fd_);
+        fd_ = NO_FD;
+    }
+}
+
+bool CaptureWriter::isOpen() const noexcept {
+    return fd_ != NO_FD;
+}
+
+CaptureReader::CaptureReader()
+    : mapping_(nullptr)
+    , size_(0)
+    , offset_(0)
+{
+}
+
+CaptureReader::~CaptureReader() {
+    unmap();
+}
+
+bool CaptureReader::open(const std::string& path) {
+    unmap();
+
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Cannot open replay file " << path
+                                        << ": " << std::strerror(errno));
+        return false;
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < capture::FILE_HEADER_SIZE) {
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Replay file too small: " << path);
+        ::close(fd);
+        return false;
+    }
+
+    void* mapping = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // Mapping stays valid after close
+    if (mapping == MAP_FAILED) {
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ mmap failed: " << std::strerror(errno));
+        return false;
+    }
+
+    mapping_ = static_cast<const char*>(mapping);
+    size_ = static_cast<size_t>(info.st_size);
+    ::madvise(const_cast<char*>(mapping_), size_, MADV_SEQUENTIAL);
+
+    uint32_t version = 0;
+    std::memcpy(&version, mapping_ + capture::MAGIC_SIZE, sizeof(version));
+    if (std::memcmp(mapping_, capture::MAGIC, capture::MAGIC_SIZE) != 0 || version != capture::VERSION) {
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Not a SIREN capture (v" << capture::VERSION << "): "
+                                        << path);
+        unmap();
+        return false;
+    }
+
+    rewind();
+    return true;
+}
+
+bool CaptureReader::next(Record& record) noexcept {
+    if (mapping_ == nullptr || size_ - offset_ < capture::RECORD_HEADER_SIZE) {
+        return false;
+    }
+
+    uint32_t length = 0;
+    std::memcpy(&record.timestamp_ns, mapping_ + offset_, sizeof(record.timestamp_ns));
+    std::memcpy(&length, mapping_ + offset_ + sizeof(record.timestamp_ns), sizeof(length));
+
+    const size_t data_offset = offset_ + capture::RECORD_HEADER_SIZE;
+    if (size_ - data_offset < length) {
+        return false; // Truncated trailing record
+    }
+
+    record.data = std::string_view(mapping_ + data_offset, length);
+    offset_ = data_offset + length;
+    return true;
+}
+
+void CaptureReader::rewind() noexcept {
+    offset_ = capture::FILE_HEADER_SIZE;
+}
+
+size_t CaptureReader::size() const noexcept {
+    return size_;
+}
+
+void CaptureReader::unmap() noexcept {
+    if (mapping_ != nullptr) {
+        ::munmap(const_cast<char*>(mapping_), size_);
+        mapping_ = nullptr;
+        size_ = 0;
+        offset_ = 0;
+    }
+}
+
+} // namespace siren::serial
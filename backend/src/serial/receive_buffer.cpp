@@ -0,0 +1,96 @@
+/**
+ * @file receive_buffer.cpp
+ * @brief Implementation of the fixed-capacity serial receive buffer
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Linear-time message framing with explicit overflow resynchronization.
+ */
+
+#include "serial/receive_buffer.hpp"
+#include <cstring>
+
+namespace siren::serial {
+
+ReceiveBuffer::ReceiveBuffer() noexcept
+    : storage_{}
+    , begin_(0)
+    , scan_(0)
+    , end_(0)
+    , resyncing_(false)
+{
+}
+
+char* ReceiveBuffer::writePointer() noexcept {
+    return storage_.data() + end_;
+}
+
+size_t ReceiveBuffer::writableSize() const noexcept {
+    return CAPACITY - end_;
+}
+
+void ReceiveBuffer::commit(size_t bytes) noexcept {
+    end_ += (bytes < writableSize()) ? bytes : writableSize();
+}
+
+bool ReceiveBuffer::nextMessage(char delimiter, std::string_view& message) noexcept {
+    while (scan_ < end_) {
+        const void* found = std::memchr(storage_.data() + scan_, delimiter, end_ - scan_);
+        if (found == nullptr) {
+            scan_ = end_; // Remember progress so the partial message is not rescanned
+            return false;
+        }
+
+        const size_t pos = static_cast<size_t>(static_cast<const char*>(found) - storage_.data());
+        const size_t start = begin_;
+        begin_ = pos + 1;
+        scan_ = begin_;
+
+        if (resyncing_) {
+            resyncing_ = false; // Tail of the overflowed message - drop it
+            continue;
+        }
+
+        message = std::string_view(storage_.data() + start, pos - start);
+        return true;
+    }
+
+    return false;
+}
+
+bool ReceiveBuffer::prepareWrite() noexcept {
+    const size_t pending = end_ - begin_;
+
+    if (resyncing_) {
+        // Still inside an overflowed message - nothing worth keeping
+        begin_ = scan_ = end_ = 0;
+        return false;
+    }
+
+    if (pending == CAPACITY) {
+        // One message filled the whole buffer without a delimiter
+        begin_ = scan_ = end_ = 0;
+        resyncing_ = true;
+        return true;
+    }
+
+    if (begin_ > 0) {
+        std::memmove(storage_.data(), storage_.data() + begin_, pending);
+        scan_ -= begin_;
+        begin_ = 0;
+        end_ = pending;
+    }
+
+    return false;
+}
+
+void ReceiveBuffer::clear() noexcept {
+    begin_ = scan_ = end_ = 0;
+    resyncing_ = false;
+}
+
+size_t ReceiveBuffer::size() const noexcept {
+    return end_ - begin_;
+}
+
+} // namespace siren::serial
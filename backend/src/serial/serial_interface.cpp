@@ -11,26 +11,49 @@
 #include "constants/communication.hpp"
 #include "constants/performance.hpp"
 #include "constants/hardware.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
+#include "utils/latency_tracker.hpp"
 #include <chrono>
 #include <filesystem>
 #include <algorithm>
+#include <cstring>
 
 namespace siren::serial {
 
 namespace constants = siren::constants;
 
+// SSOT for framing delimiters (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr const char* COMPONENT_NAME = "SerialInterface";
+    constexpr char LINE_DELIMITER = '\n';
+    constexpr char FRAME_DELIMITER = static_cast<char>(constants::hardware::arduino::binary_frame::DELIMITER);
+}
+
 SerialInterface::SerialInterface(boost::asio::io_context& io_context)
     : io_context_(io_context)
+    , strand_(boost::asio::make_strand(io_context))
     , serial_port_(nullptr)
     , reconnect_timer_(nullptr)
     , connection_state_(ConnectionState::DISCONNECTED)
     , shutdown_requested_(false)
     , protocol_parser_(std::make_unique<ArduinoProtocolParser>())
+    , frame_decoder_(std::make_unique<BinaryFrameDecoder>(*protocol_parser_))
+    , protocol_mode_(ProtocolMode::ASCII)
+    , binary_mode_requested_(false)
+    , replay_timer_(nullptr)
+    , replaying_(false)
+    , replay_speed_(constants::communication::capture::DEFAULT_REPLAY_SPEED)
+    , replay_previous_ns_(0)
+    , replay_offset_ns_(0)
+    , replay_chunks_(0)
+    , replay_bytes_(0)
+    , replay_start_(std::chrono::steady_clock::now())
+    , replay_record_{}
+    , replay_record_pending_(false)
     , last_data_time_(std::chrono::steady_clock::now())
     , connection_start_time_(std::chrono::steady_clock::now())
 {
-    std::cout << "[SerialInterface] Initializing military-grade serial communication..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing military-grade serial communication...");
 
     // Initialize statistics
     statistics_ = data::SerialStatistics{};
@@ -46,15 +69,15 @@ bool SerialInterface::initialize(const std::string& port_name) {
     try {
         port_name_ = port_name;
 
-        std::cout << "[SerialInterface] Initializing port: " << port_name << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Initializing port: " << port_name);
 
         // Create serial port
-        serial_port_ = std::make_unique<boost::asio::serial_port>(io_context_);
+        serial_port_ = std::make_unique<boost::asio::serial_port>(strand_);
 
         // Create reconnect timer
-        reconnect_timer_ = std::make_unique<boost::asio::steady_timer>(io_context_);
+        reconnect_timer_ = std::make_unique<boost::asio::steady_timer>(strand_);
 
-        std::cout << "[SerialInterface] ✅ Initialization complete" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "✅ Initialization complete");
         return true;
 
     } catch (const std::exception& e) {
@@ -68,7 +91,7 @@ bool SerialInterface::start() {
     try {
         updateConnectionState(ConnectionState::CONNECTING);
 
-        std::cout << "[SerialInterface] 🚀 Opening serial port: " << port_name_ << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "🚀 Opening serial port: " << port_name_);
 
         // Open the serial port
         serial_port_->open(port_name_);
@@ -78,6 +101,10 @@ bool SerialInterface::start() {
             return false;
         }
 
+        // Every new connection starts in ASCII mode (the Arduino resets on open)
+        protocol_mode_.store(ProtocolMode::ASCII);
+        binary_mode_requested_ = false;
+
         // Configure port settings
         if (!configurePort()) {
             handleConnectionError("Failed to configure serial port", data::ErrorSeverity::ERROR);
@@ -89,12 +116,12 @@ bool SerialInterface::start() {
         connection_start_time_ = std::chrono::steady_clock::now();
 
         // Clear any existing data in the buffer
-        message_buffer_.clear();
+        receive_buffer_.clear();
 
         // Start asynchronous reading
         startAsyncRead();
 
-        std::cout << "[SerialInterface] ✅ Serial communication started - Ready for Arduino data" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "✅ Serial communication started - Ready for Arduino data");
         return true;
 
     } catch (const std::exception& e) {
@@ -105,7 +132,7 @@ bool SerialInterface::start() {
 }
 
 void SerialInterface::stop() {
-    std::cout << "[SerialInterface] 🛑 Stopping serial communication..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "🛑 Stopping serial communication...");
 
     shutdown_requested_.store(true);
 
@@ -114,18 +141,60 @@ void SerialInterface::stop() {
         reconnect_timer_->cancel();
     }
 
+    // Cancel replay and flush capture
+    if (replay_timer_) {
+        replay_timer_->cancel();
+    }
+    replaying_ = false;
+    capture_writer_.close();
+
     // Close serial port
     if (serial_port_ && serial_port_->is_open()) {
         try {
             serial_port_->cancel();
             serial_port_->close();
         } catch (const std::exception& e) {
-            std::cout << "[SerialInterface] ⚠️ Error closing port: " << e.what() << std::endl;
+            SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Error closing port: " << e.what());
         }
     }
 
     updateConnectionState(ConnectionState::DISCONNECTED);
-    std::cout << "[SerialInterface] ✅ Serial communication stopped" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "✅ Serial communication stopped");
+}
+
+bool SerialInterface::enableCapture(const std::string& path) {
+    return capture_writer_.open(path);
+}
+
+bool SerialInterface::startReplay(const std::string& path, double speed) {
+    if (!replay_reader_.open(path)) {
+        handleConnectionError("Replay file unavailable: " + path, data::ErrorSeverity::ERROR);
+        return false;
+    }
+
+    replay_timer_ = std::make_unique<boost::asio::steady_timer>(strand_);
+    replaying_ = true;
+    replay_speed_ = (speed > 0.0) ? speed : 0.0;
+    replay_previous_ns_ = 0;
+    replay_offset_ns_ = 0;
+    replay_chunks_ = 0;
+    replay_bytes_ = 0;
+    replay_record_pending_ = false;
+
+    // The capture already contains whatever handshake the firmware answered
+    protocol_mode_.store(ProtocolMode::ASCII);
+    binary_mode_requested_ = true;
+    receive_buffer_.clear();
+
+    updateConnectionState(ConnectionState::CONNECTED);
+    connection_start_time_ = std::chrono::steady_clock::now();
+    replay_start_ = connection_start_time_;
+
+    SIREN_LOG_INFO(COMPONENT_NAME, "⏯️ Replaying " << path << " (" << replay_reader_.size() << " bytes) at "
+                                   << (replay_speed_ > 0.0 ? std::to_string(replay_speed_) + "x" : std::string("max")) << " speed");
+
+    scheduleReplay();
+    return true;
 }
 
 bool SerialInterface::isConnected() const noexcept {
@@ -140,6 +209,15 @@ void SerialInterface::setDataCallback(DataCallback callback) {
     data_callback_ = std::move(callback);
 }
 
+void SerialInterface::setEnvironmentCallback(EnvironmentCallback callback) {
+    environment_callback_ = std::move(callback);
+}
+
+std::optional<data::EnvironmentalData> SerialInterface::getLatestEnvironment() const {
+    std::lock_guard<std::mutex> lock(environment_mutex_);
+    return latest_environment_;
+}
+
 void SerialInterface::setErrorCallback(ErrorCallback callback) {
     error_callback_ = std::move(callback);
 }
@@ -164,8 +242,8 @@ data::SerialStatistics SerialInterface::getStatistics() const {
 }
 
 void SerialInterface::sendCommand(const std::string& command) {
-    if (!isConnected()) {
-        std::cout << "[SerialInterface] ⚠️ Cannot send command - not connected" << std::endl;
+    if (!isConnected() || !serial_port_ || !serial_port_->is_open()) {
+        SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Cannot send command - not connected");
         return;
     }
 
@@ -178,7 +256,7 @@ void SerialInterface::sendCommand(const std::string& command) {
             statistics_.messages_sent++;
         }
 
-        std::cout << "[SerialInterface] 📤 Sent command: " << command << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "📤 Sent command: " << command);
 
     } catch (const std::exception& e) {
         handleConnectionError("Failed to send command: " + std::string(e.what()),
@@ -186,19 +264,23 @@ void SerialInterface::sendCommand(const std::string& command) {
     }
 }
 
+SerialInterface::ProtocolMode SerialInterface::getProtocolMode() const noexcept {
+    return protocol_mode_.load();
+}
+
 std::string SerialInterface::autoDetectArduinoPort() {
-    std::cout << "[SerialInterface] 🔍 Auto-detecting Arduino port..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "🔍 Auto-detecting Arduino port...");
 
     auto ports = getAvailablePorts();
 
     for (const auto& port : ports) {
         if (isArduinoPort(port)) {
-            std::cout << "[SerialInterface] ✅ Found Arduino at: " << port << std::endl;
+            SIREN_LOG_INFO(COMPONENT_NAME, "✅ Found Arduino at: " << port);
             return port;
         }
     }
 
-    std::cout << "[SerialInterface] ❌ No Arduino port detected" << std::endl;
+    SIREN_LOG_ERROR(COMPONENT_NAME, "❌ No Arduino port detected");
     return "";
 }
 
@@ -222,13 +304,13 @@ bool SerialInterface::configurePort() {
         serial_port_->set_option(boost::asio::serial_port_base::flow_control(
             boost::asio::serial_port_base::flow_control::none));
 
-        std::cout << "[SerialInterface] Port configured: " << constants::communication::serial::BAUD_RATE
-                  << " baud, 8N1, no flow control" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Port configured: " << constants::communication::serial::BAUD_RATE
+                                       << " baud, 8N1, no flow control");
 
         return true;
 
     } catch (const std::exception& e) {
-        std::cout << "[SerialInterface] ❌ Port configuration failed: " << e.what() << std::endl;
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Port configuration failed: " << e.what());
         return false;
     }
 }
@@ -239,8 +321,9 @@ void SerialInterface::startAsyncRead() {
     }
 
     serial_port_->async_read_some(
-        boost::asio::buffer(read_buffer_, BUFFER_SIZE),
+        boost::asio::buffer(receive_buffer_.writePointer(), receive_buffer_.writableSize()),
         [this](const boost::system::error_code& error, std::size_t bytes_transferred) {
+            utils::ScopedHandlerTimer timer;
             handleRead(error, bytes_transferred);
         });
 }
@@ -260,29 +343,50 @@ void SerialInterface::handleRead(const boost::system::error_code& error,
     if (bytes_transferred > 0) {
         auto processing_start = std::chrono::steady_clock::now();
 
-        // Add received data to buffer
-        message_buffer_.append(read_buffer_.data(), bytes_transferred);
+        // One receipt time for every sample completed by this chunk
+        const auto receipt_timestamp_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(processing_start.time_since_epoch()).count());
 
-        // Process complete messages (ending with newline)
-        size_t pos = 0;
-        while ((pos = message_buffer_.find('\n')) != std::string::npos) {
-            std::string message = message_buffer_.substr(0, pos);
-            message_buffer_.erase(0, pos + 1);
+        // Raw capture before any parsing, so replays see exactly what arrived
+        if (capture_writer_.isOpen() && !replaying_) {
+            const auto timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                processing_start.time_since_epoch()).count();
+            capture_writer_.write(static_cast<uint64_t>(timestamp_ns),
+                                  receive_buffer_.writePointer(), bytes_transferred);
+        }
 
-            // Remove carriage return if present
-            if (!message.empty() && message.back() == '\r') {
-                message.pop_back();
-            }
+        // Data was read directly into the receive buffer
+        receive_buffer_.commit(bytes_transferred);
+
+        // Process complete messages (newline-terminated lines or 0x00-delimited frames).
+        // Mode is re-read per message because an ACK line switches framing mid-buffer.
+        bool binary = (protocol_mode_.load() == ProtocolMode::BINARY);
+        std::string_view message;
+        while (receive_buffer_.nextMessage(binary ? FRAME_DELIMITER : LINE_DELIMITER, message)) {
+            if (binary) {
+                if (!message.empty()) {
+                    processFrame(message, receipt_timestamp_us);
+                }
+            } else {
+                // Remove carriage return if present
+                if (!message.empty() && message.back() == '\r') {
+                    message.remove_suffix(1);
+                }
 
-            if (!message.empty()) {
-                processMessage(message);
+                if (!message.empty()) {
+                    processMessage(message, receipt_timestamp_us);
+                }
             }
+            binary = (protocol_mode_.load() == ProtocolMode::BINARY);
         }
 
-        // Prevent buffer from growing too large
-        if (message_buffer_.size() > BUFFER_SIZE * 2) {
-            message_buffer_.clear();
-            std::cout << "[SerialInterface] ⚠️ Message buffer cleared - size exceeded limit" << std::endl;
+        // Oversized message: dropped, resync on the next delimiter
+        if (receive_buffer_.prepareWrite()) {
+            {
+                std::lock_guard<std::mutex> lock(stats_mutex_);
+                statistics_.buffer_overflows++;
+            }
+            SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Receive buffer overflow - resyncing to next delimiter");
         }
 
         // Update statistics
@@ -307,24 +411,107 @@ void SerialInterface::handleRead(const boost::system::error_code& error,
 }
 
 
-void SerialInterface::processMessage(const std::string& message) {
-    auto sonar_data = protocol_parser_->parseSonarData(message);
+void SerialInterface::scheduleReplay() {
+    boost::asio::post(strand_, [this]() {
+        utils::ScopedHandlerTimer timer;
+        onReplayStep();
+    });
+}
 
-    if (sonar_data.has_value()) {
-        // Update statistics
-        {
-            std::lock_guard<std::mutex> lock(stats_mutex_);
-            statistics_.messages_received++;
-            statistics_.last_message_time = std::chrono::steady_clock::now();
+void SerialInterface::onReplayStep() {
+    if (shutdown_requested_.load() || !replaying_) {
+        return;
+    }
+
+    size_t fed = 0;
+    while (true) {
+        if (!replay_record_pending_) {
+            if (!replay_reader_.next(replay_record_)) {
+                finishReplay();
+                return;
+            }
+
+            // Rebase when timestamps go backwards (several sessions appended to one file)
+            if (replay_chunks_ > 0 && replay_record_.timestamp_ns > replay_previous_ns_) {
+                replay_offset_ns_ += replay_record_.timestamp_ns - replay_previous_ns_;
+            }
+            replay_previous_ns_ = replay_record_.timestamp_ns;
+            replay_record_pending_ = true;
         }
 
-        // Call data callback if set
-        if (data_callback_) {
-            data_callback_(sonar_data.value());
+        if (replay_speed_ > 0.0) {
+            // Paced: wait until the chunk is due on the scaled capture timeline
+            const auto due = replay_start_ + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::nanoseconds(static_cast<int64_t>(static_cast<double>(replay_offset_ns_) / replay_speed_)));
+            if (due > std::chrono::steady_clock::now()) {
+                replay_timer_->expires_at(due);
+                replay_timer_->async_wait([this](const boost::system::error_code& error) {
+                    utils::ScopedHandlerTimer timer;
+                    if (!error) {
+                        onReplayStep();
+                    }
+                });
+                return;
+            }
+        } else if (fed >= constants::communication::capture::REPLAY_BATCH_CHUNKS) {
+            // As fast as possible, but yield so other handlers keep running
+            scheduleReplay();
+            return;
         }
 
-        std::cout << "[SerialInterface] 📡 Sonar data: angle="
-                  << sonar_data->angle << "°, distance=" << sonar_data->distance << "cm" << std::endl;
+        feedReplayChunk(replay_record_.data);
+        replay_record_pending_ = false;
+        ++fed;
+    }
+}
+
+void SerialInterface::feedReplayChunk(std::string_view chunk) {
+    // Same path as a real read: copy into the receive buffer, then handleRead()
+    while (!chunk.empty() && !shutdown_requested_.load()) {
+        const size_t bytes = std::min(chunk.size(), receive_buffer_.writableSize());
+        std::memcpy(receive_buffer_.writePointer(), chunk.data(), bytes);
+        chunk.remove_prefix(bytes);
+        replay_bytes_ += bytes;
+        handleRead(boost::system::error_code{}, bytes);
+    }
+    ++replay_chunks_;
+}
+
+void SerialInterface::finishReplay() {
+    replaying_ = false;
+
+    const double elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - replay_start_).count();
+    const auto stats = getStatistics();
+
+    SIREN_LOG_INFO(COMPONENT_NAME, "⏹️ Replay complete: " << replay_chunks_ << " chunks, "
+                                   << replay_bytes_ << " bytes, " << stats.messages_received << " messages, "
+                                   << stats.parse_errors << " parse errors in " << elapsed << " s");
+    if (elapsed > 0.0) {
+        SIREN_LOG_INFO(COMPONENT_NAME, "📊 Replay throughput: "
+                                       << static_cast<double>(stats.messages_received) / elapsed << " messages/s, "
+                                       << static_cast<double>(replay_bytes_) / elapsed << " bytes/s");
+    }
+
+    updateConnectionState(ConnectionState::DISCONNECTED);
+}
+
+void SerialInterface::processMessage(std::string_view message, uint64_t receipt_timestamp_us) {
+    if (message == constants::communication::serial::BINARY_MODE_ACK) {
+        switchToBinaryProtocol();
+        return;
+    }
+
+    std::optional<data::EnvironmentalData> environment;
+    auto sonar_data = protocol_parser_->parseSonarData(message, environment, receipt_timestamp_us);
+
+    if (sonar_data.has_value()) {
+        deliverSample(sonar_data.value(), environment);
+
+        // Firmware is up and talking - negotiate the binary protocol once per connection
+        if (constants::communication::serial::BINARY_PROTOCOL_ENABLED && !binary_mode_requested_) {
+            requestBinaryProtocol();
+        }
     } else {
         // Update parse error statistics
         {
@@ -334,10 +521,88 @@ void SerialInterface::processMessage(const std::string& message) {
     }
 }
 
+void SerialInterface::processFrame(std::string_view frame, uint64_t receipt_timestamp_us) {
+    auto decoded = frame_decoder_->decodeFrame(frame, receipt_timestamp_us);
+
+    if (decoded.has_value()) {
+        deliverSample(decoded->point, decoded->environment);
+    } else {
+        // Framing, CRC or validation failure - the next delimiter resynchronizes
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        statistics_.parse_errors++;
+    }
+}
+
+void SerialInterface::deliverSample(const data::SonarDataPoint& point,
+                                    const std::optional<data::EnvironmentalData>& environment) {
+    if (environment.has_value()) {
+        updateEnvironment(*environment);
+    }
+
+    // Update statistics
+    {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        statistics_.messages_received++;
+        statistics_.last_message_time = std::chrono::steady_clock::now();
+    }
+
+    // Call data callback if set
+    if (data_callback_) {
+        data_callback_(point);
+    }
+
+    SIREN_LOG_DEBUG(COMPONENT_NAME, "📡 Sonar data: angle="
+                                    << point.angle << "°, distance=" << point.distance << "cm");
+}
+
+void SerialInterface::requestBinaryProtocol() {
+    binary_mode_requested_ = true;
+
+    // Firmware without binary support ignores the command and keeps sending ASCII
+    SIREN_LOG_INFO(COMPONENT_NAME, "🤝 Requesting binary protocol at "
+                                   << constants::communication::serial::BINARY_BAUD_RATE << " baud");
+    sendCommand(constants::communication::serial::BINARY_MODE_COMMAND);
+}
+
+void SerialInterface::switchToBinaryProtocol() {
+    try {
+        // Replays have no port - the captured bytes already follow the switch
+        if (serial_port_ && serial_port_->is_open()) {
+            serial_port_->set_option(boost::asio::serial_port_base::baud_rate(
+                constants::communication::serial::BINARY_BAUD_RATE));
+        }
+    } catch (const std::exception& e) {
+        handleConnectionError("Failed to switch baud rate: " + std::string(e.what()),
+                            data::ErrorSeverity::WARNING);
+        return;
+    }
+
+    // Bytes buffered so far were sent before the switch - drop them
+    receive_buffer_.clear();
+    protocol_mode_.store(ProtocolMode::BINARY);
+
+    SIREN_LOG_INFO(COMPONENT_NAME, "✅ Binary protocol active: "
+                                   << constants::communication::serial::BINARY_BAUD_RATE << " baud, COBS + CRC16 frames");
+}
+
+void SerialInterface::updateEnvironment(const data::EnvironmentalData& environment) {
+    {
+        std::lock_guard<std::mutex> lock(environment_mutex_);
+        if (latest_environment_.has_value() && latest_environment_->sameReadingAs(environment)) {
+            return; // Unchanged - already delivered
+        }
+        latest_environment_ = environment;
+    }
+
+    if (environment_callback_) {
+        environment_callback_(environment);
+    }
+}
+
 void SerialInterface::handleConnectionError(const std::string& error_message,
                                           data::ErrorSeverity severity) {
-    std::cout << "[SerialInterface] ERROR [" << static_cast<int>(severity)
-              << "]: " << error_message << std::endl;
+    SIREN_LOG_ERROR(COMPONENT_NAME, "Connection error [" << static_cast<int>(severity)
+                                    << "]: " << error_message);
 
     {
         std::lock_guard<std::mutex> lock(stats_mutex_);
@@ -360,12 +625,13 @@ void SerialInterface::attemptReconnection() {
 
     updateConnectionState(ConnectionState::RECONNECTING);
 
-    std::cout << "[SerialInterface] 🔄 Attempting reconnection in "
-              << constants::communication::serial::RECONNECT_DELAY.count() << " seconds..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "🔄 Attempting reconnection in "
+                                   << constants::communication::serial::RECONNECT_DELAY.count() << " seconds...");
 
     reconnect_timer_->expires_after(constants::communication::serial::RECONNECT_DELAY);
     reconnect_timer_->async_wait(
         [this](const boost::system::error_code& error) {
+            utils::ScopedHandlerTimer timer;
             onReconnectTimer(error);
         });
 }
@@ -375,7 +641,7 @@ void SerialInterface::onReconnectTimer(const boost::system::error_code& error) {
         return;
     }
 
-    std::cout << "[SerialInterface] 🔄 Reconnecting..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "🔄 Reconnecting...");
 
     // Close existing connection
     if (serial_port_ && serial_port_->is_open()) {
@@ -388,9 +654,9 @@ void SerialInterface::onReconnectTimer(const boost::system::error_code& error) {
 
     // Attempt to restart
     if (start()) {
-        std::cout << "[SerialInterface] ✅ Reconnection successful" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "✅ Reconnection successful");
     } else {
-        std::cout << "[SerialInterface] ❌ Reconnection failed, retrying..." << std::endl;
+        SIREN_LOG_ERROR(COMPONENT_NAME, "❌ Reconnection failed, retrying...");
         attemptReconnection();
     }
 }
@@ -399,9 +665,9 @@ void SerialInterface::updateConnectionState(ConnectionState new_state) {
     auto old_state = connection_state_.exchange(new_state);
 
     if (old_state != new_state) {
-        std::cout << "[SerialInterface] State transition: "
-                  << static_cast<int>(old_state) << " → "
-                  << static_cast<int>(new_state) << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "State transition: "
+                                       << static_cast<int>(old_state) << " → "
+                                       << static_cast<int>(new_state));
     }
 }
 
@@ -443,7 +709,7 @@ std::vector<std::string> SerialInterface::getAvailablePorts() {
         std::sort(ports.begin(), ports.end());
 
     } catch (const std::exception& e) {
-        std::cout << "[SerialInterface] ⚠️ Error scanning ports: " << e.what() << std::endl;
+        SIREN_LOG_WARNING(COMPONENT_NAME, "⚠️ Error scanning ports: " << e.what());
     }
 
     return ports;
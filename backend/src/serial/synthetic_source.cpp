@@ -0,0 +1,215 @@
+/**
+ * @file synthetic_source.cpp
+ * @brief Implementation of the built-in synthetic sonar source
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "serial/synthetic_source.hpp"
+#include "constants/communication.hpp"
+#include "constants/hardware.hpp"
+#include "constants/math.hpp"
+#include "utils/error_handler.hpp"
+#include "utils/logger.hpp"
+#include "utils/latency_tracker.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace siren::serial {
+
+// SSOT for synthetic scene script (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr const char* COMPONENT_NAME = "SyntheticSource";
+    namespace synth = siren::constants::communication::synthetic;
+    namespace hw = siren::constants::hardware;
+    namespace math = siren::constants::math::fundamental;
+
+    constexpr double MICROSECONDS_PER_SECOND = 1000000.0;
+    constexpr uint8_t SAMPLE_QUALITY = 100;
+
+    /// Room around the sensor: back wall ahead, side walls left and right (sensor at origin, y ahead)
+    constexpr double BACK_WALL_CM = 320.0;
+    constexpr double SIDE_WALL_CM = 250.0;
+
+    /// Round target moving on an ellipse: centre + amplitude x (sin, cos) of its phase
+    struct SceneTarget {
+        double center_x_cm;
+        double center_y_cm;
+        double amplitude_x_cm;
+        double amplitude_y_cm;
+        double period_s;
+        double phase_rad;
+        double radius_cm;
+    };
+
+    /// Scripted targets: one crossing left to right, one circling, one approaching and receding
+    constexpr std::array<SceneTarget, 3> SCENE_TARGETS = {{
+        {-20.0, 140.0, 110.0, 0.0, 8.0, 0.0, 15.0},
+        {90.0, 230.0, 40.0, 50.0, 12.0, 1.5, 25.0},
+        {-40.0, 90.0, 0.0, 50.0, 5.0, 0.0, 8.0},
+    }};
+}
+
+SyntheticSource::SyntheticSource(boost::asio::io_context& io_context)
+    : strand_(boost::asio::make_strand(io_context))
+    , tick_timer_(nullptr)
+    , running_(false)
+    , rate_hz_(0.0)
+    , tick_interval_(synth::TICK_INTERVAL_US)
+    , start_time_(std::chrono::steady_clock::now())
+    , start_timestamp_us_(0)
+    , samples_due_(0)
+    , samples_emitted_(0)
+    , samples_skipped_(0)
+    , angle_(hw::servo::MIN_ANGLE_DEGREES)
+    , direction_(1)
+    , rng_(synth::NOISE_SEED)
+    , noise_(0.0, synth::NOISE_STDDEV_CM)
+{
+}
+
+SyntheticSource::~SyntheticSource() {
+    if (running_.load()) {
+        stop();
+    }
+}
+
+bool SyntheticSource::start(double rate_hz) {
+    if (!(rate_hz >= synth::MIN_RATE_HZ && rate_hz <= synth::MAX_RATE_HZ)) {
+        utils::ErrorHandler::handleSystemError(COMPONENT_NAME,
+            "Synthetic rate " + std::to_string(rate_hz) + " samples/s out of range",
+            data::ErrorSeverity::ERROR);
+        return false;
+    }
+
+    rate_hz_ = rate_hz;
+
+    // Slow rates wake once per sample, fast ones once per tick
+    const auto sample_period = std::chrono::microseconds(
+        static_cast<int64_t>(MICROSECONDS_PER_SECOND / rate_hz_));
+    tick_interval_ = std::max(std::chrono::microseconds(synth::TICK_INTERVAL_US), sample_period);
+
+    start_time_ = std::chrono::steady_clock::now();
+    start_timestamp_us_ = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        start_time_.time_since_epoch()).count());
+    samples_due_ = 0;
+    samples_emitted_ = 0;
+    samples_skipped_ = 0;
+
+    tick_timer_ = std::make_unique<boost::asio::steady_timer>(strand_);
+    running_.store(true);
+
+    SIREN_LOG_INFO(COMPONENT_NAME, "🧪 Synthetic scene at " << rate_hz_ << " samples/s ("
+                                   << SCENE_TARGETS.size() << " moving targets, "
+                                   << synth::NOISE_STDDEV_CM << "cm noise)");
+
+    scheduleTick();
+    return true;
+}
+
+void SyntheticSource::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    if (tick_timer_) {
+        tick_timer_->cancel();
+    }
+
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+    SIREN_LOG_INFO(COMPONENT_NAME, "⏹️ Synthetic source stopped: " << samples_emitted_ << " samples ("
+                                   << (elapsed_s > 0.0 ? static_cast<double>(samples_emitted_) / elapsed_s : 0.0)
+                                   << " samples/s), " << samples_skipped_ << " skipped behind schedule");
+}
+
+void SyntheticSource::setDataCallback(DataCallback callback) {
+    data_callback_ = std::move(callback);
+}
+
+void SyntheticSource::scheduleTick() {
+    tick_timer_->expires_after(tick_interval_);
+    tick_timer_->async_wait([this](const boost::system::error_code& error) {
+        utils::ScopedHandlerTimer timer;
+        if (!error && running_.load()) {
+            onTick();
+        }
+    });
+}
+
+void SyntheticSource::onTick() {
+    const double elapsed_us = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time_).count());
+    const uint64_t due = static_cast<uint64_t>(elapsed_us * rate_hz_ / MICROSECONDS_PER_SECOND);
+
+    // Consumers saturated: skip what is already too old instead of emitting it late
+    const uint64_t max_backlog = static_cast<uint64_t>(
+        static_cast<double>(synth::MAX_LAG_US) * rate_hz_ / MICROSECONDS_PER_SECOND);
+    if (due > samples_due_ + max_backlog) {
+        const uint64_t resume_at = due - max_backlog;
+        samples_skipped_ += resume_at - samples_due_;
+        samples_due_ = resume_at;
+    }
+
+    for (; samples_due_ < due && running_.load(); ++samples_due_) {
+        const data::SonarDataPoint point = nextSample(samples_due_);
+        if (data_callback_) {
+            data_callback_(point);
+        }
+        ++samples_emitted_;
+    }
+
+    scheduleTick();
+}
+
+data::SonarDataPoint SyntheticSource::nextSample(uint64_t index) {
+    const double scene_time_s = static_cast<double>(index) / rate_hz_;
+    const double range_cm = sceneRange(angle_, scene_time_s) + noise_(rng_);
+    const auto distance = static_cast<int16_t>(std::clamp<long>(std::lround(range_cm),
+        hw::sensor::MIN_DISTANCE_CM, hw::sensor::MAX_DISTANCE_CM));
+
+    data::SonarDataPoint point(angle_, distance, SAMPLE_QUALITY);
+    point.timestamp_us = start_timestamp_us_ + static_cast<uint64_t>(scene_time_s * MICROSECONDS_PER_SECOND);
+
+    // Bidirectional sweep, same step and limits as the firmware
+    const int next = angle_ + direction_ * hw::servo::STEP_SIZE_DEGREES;
+    if (next > hw::servo::MAX_ANGLE_DEGREES || next < hw::servo::MIN_ANGLE_DEGREES) {
+        direction_ = static_cast<int16_t>(-direction_);
+    }
+    angle_ = static_cast<int16_t>(angle_ + direction_ * hw::servo::STEP_SIZE_DEGREES);
+
+    return point;
+}
+
+double SyntheticSource::sceneRange(int16_t angle_degrees, double scene_time_s) {
+    const double beam_x = std::cos(angle_degrees * math::DEG_TO_RAD);
+    const double beam_y = std::sin(angle_degrees * math::DEG_TO_RAD);
+
+    // Walls: first plane hit along the beam
+    double range = BACK_WALL_CM / beam_y;
+    if (std::abs(beam_x) > std::numeric_limits<double>::epsilon()) {
+        range = std::min(range, SIDE_WALL_CM / std::abs(beam_x));
+    }
+
+    // Targets: nearest ray-circle intersection in front of the sensor
+    for (const SceneTarget& target : SCENE_TARGETS) {
+        const double phase = 2.0 * math::PI * scene_time_s / target.period_s + target.phase_rad;
+        const double x = target.center_x_cm + target.amplitude_x_cm * std::sin(phase);
+        const double y = target.center_y_cm + target.amplitude_y_cm * std::cos(phase);
+
+        const double along = beam_x * x + beam_y * y;
+        const double discriminant = along * along - (x * x + y * y - target.radius_cm * target.radius_cm);
+        if (discriminant >= 0.0) {
+            const double hit = along - std::sqrt(discriminant);
+            if (hit > 0.0) {
+                range = std::min(range, hit);
+            }
+        }
+    }
+
+    return range;
+}
+
+} // namespace siren::serial
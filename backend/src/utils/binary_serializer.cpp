@@ -0,0 +1,106 @@
+/**
+ * @file binary_serializer.cpp
+ * @brief Implementation of binary frame serialization
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "utils/binary_serializer.hpp"
+#include "constants/message.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace siren::utils {
+
+namespace protocol = siren::constants::message::binary_protocol;
+
+namespace {
+    constexpr uint32_t BITS_PER_BYTE = 8;
+
+    /// Append an unsigned value least-significant byte first
+    template<typename T>
+    void appendLittleEndian(std::string& out, T value) {
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            out.push_back(static_cast<char>((value >> (i * BITS_PER_BYTE)) & 0xFF));
+        }
+    }
+
+    void appendInt16(std::string& out, int16_t value) {
+        appendLittleEndian(out, static_cast<uint16_t>(value));
+    }
+
+    void appendFloat(std::string& out, float value) {
+        static_assert(sizeof(float) == sizeof(uint32_t), "IEEE-754 binary32 required");
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        appendLittleEndian(out, bits);
+    }
+
+    /// Sonar point as laid out after the type byte of a sonar frame
+    void appendSonarRecord(std::string& out, const data::SonarDataPoint& data) {
+        out.push_back(static_cast<char>(data.quality));
+        appendInt16(out, data.angle);
+        appendInt16(out, data.distance);
+        appendLittleEndian(out, data.timestamp_us);
+        appendLittleEndian(out, data.sequence);
+    }
+}
+
+std::string BinarySerializer::serialize(const data::SonarDataPoint& data) {
+    std::string frame;
+    frame.reserve(protocol::SONAR_FRAME_SIZE);
+
+    frame.push_back(static_cast<char>(protocol::FRAME_SONAR_DATA));
+    appendSonarRecord(frame, data);
+
+    return frame;
+}
+
+std::string BinarySerializer::serialize(const data::SonarBatch& batch) {
+    return serializePoints(protocol::FRAME_SONAR_BATCH,
+                           batch.sweep_complete ? protocol::FLAG_SWEEP_COMPLETE : 0,
+                           batch.sweep_count, batch.points);
+}
+
+std::string BinarySerializer::serialize(const data::ScanSnapshot& snapshot) {
+    return serializePoints(protocol::FRAME_SCAN_SNAPSHOT, 0, 0, snapshot.points);
+}
+
+std::string BinarySerializer::serialize(const data::SonarReplay& replay) {
+    return serializePoints(protocol::FRAME_SONAR_REPLAY, 0, 0, replay.points);
+}
+
+std::string BinarySerializer::serializePoints(uint8_t frame_type, uint8_t flags, uint32_t sweep_count,
+                                              const std::vector<data::SonarDataPoint>& points) {
+    const size_t count = std::min<size_t>(points.size(), std::numeric_limits<uint16_t>::max());
+
+    std::string frame;
+    frame.reserve(protocol::SONAR_BATCH_HEADER_SIZE + count * protocol::SONAR_BATCH_RECORD_SIZE);
+
+    frame.push_back(static_cast<char>(frame_type));
+    frame.push_back(static_cast<char>(flags));
+    appendLittleEndian(frame, static_cast<uint16_t>(count));
+    appendLittleEndian(frame, sweep_count);
+
+    for (size_t i = 0; i < count; ++i) {
+        appendSonarRecord(frame, points[i]);
+    }
+
+    return frame;
+}
+
+std::string BinarySerializer::serialize(const data::EnvironmentalData& environment) {
+    std::string frame;
+    frame.reserve(protocol::ENVIRONMENT_FRAME_SIZE);
+
+    frame.push_back(static_cast<char>(protocol::FRAME_ENVIRONMENT_DATA));
+    appendFloat(frame, environment.temperature_c);
+    appendFloat(frame, environment.humidity_percent);
+    appendFloat(frame, environment.sound_speed_cm_per_us);
+    appendLittleEndian(frame, environment.timestamp_us);
+
+    return frame;
+}
+
+} // namespace siren::utils
@@ -0,0 +1,69 @@
+/**
+ * @file change_detector.cpp
+ * @brief Implementation of per-angle change detection
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "utils/change_detector.hpp"
+#include <cstdlib>
+
+namespace siren::utils {
+
+ChangeDetector::ChangeDetector()
+    : table_mutex_()
+    , threshold_cm_(constants::communication::delta::DEFAULT_THRESHOLD_CM)
+    , keyframe_interval_us_(constants::communication::delta::DEFAULT_KEYFRAME_INTERVAL_US)
+    , last_distance_()
+    , last_sent_us_()
+    , sent_()
+{
+}
+
+void ChangeDetector::configure(int16_t threshold_cm, uint64_t keyframe_interval_us) {
+    std::lock_guard<std::mutex> lock(table_mutex_);
+    threshold_cm_ = threshold_cm;
+    keyframe_interval_us_ = keyframe_interval_us;
+}
+
+bool ChangeDetector::update(const data::SonarDataPoint& point) {
+    std::lock_guard<std::mutex> lock(table_mutex_);
+    return updateLocked(point);
+}
+
+data::SonarBatch ChangeDetector::reduce(const data::SonarBatch& batch) {
+    data::SonarBatch changed;
+    changed.sweep_count = batch.sweep_count;
+    changed.sweep_complete = batch.sweep_complete;
+    changed.points.reserve(batch.points.size());
+
+    std::lock_guard<std::mutex> lock(table_mutex_);
+    for (const auto& point : batch.points) {
+        if (updateLocked(point)) {
+            changed.points.push_back(point);
+        }
+    }
+    return changed;
+}
+
+bool ChangeDetector::updateLocked(const data::SonarDataPoint& point) {
+    if (point.angle < 0 || static_cast<size_t>(point.angle) >= ANGLE_BIN_COUNT) {
+        return true;
+    }
+
+    const size_t bin = static_cast<size_t>(point.angle);
+    const bool changed = !sent_.test(bin)
+        || std::abs(point.distance - last_distance_[bin]) > threshold_cm_;
+    const bool keyframe_due = (keyframe_interval_us_ > 0)
+        && (point.timestamp_us >= last_sent_us_[bin] + keyframe_interval_us_);
+    if (!changed && !keyframe_due) {
+        return false;
+    }
+
+    last_distance_[bin] = point.distance;
+    last_sent_us_[bin] = point.timestamp_us;
+    sent_.set(bin);
+    return true;
+}
+
+} // namespace siren::utils
@@ -7,7 +7,7 @@
 
 #include "utils/error_handler.hpp"
 #include "constants/error.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -17,7 +17,6 @@ namespace siren::utils {
 namespace cnst = siren::constants;
 
 // Static member definitions
-std::mutex ErrorHandler::logging_mutex_;
 std::atomic<uint32_t> ErrorHandler::error_counter_{cnst::error::handling::ERROR_CODE_BASE}; // Start from 1000 for military-grade error codes
 
 void ErrorHandler::handleSystemError(const std::string& component,
@@ -121,13 +120,17 @@ const char* ErrorHandler::getSeveritySymbol(data::ErrorSeverity severity) {
 
 void ErrorHandler::logError(const std::string& formatted_message,
                             data::ErrorSeverity severity) {
-    std::lock_guard<std::mutex> lock(logging_mutex_);
+    // Message is already prefixed with its component; FATAL maps to CRITICAL (stderr)
+    LogLevel level = LogLevel::CRITICAL;
+    switch (severity) {
+        case data::ErrorSeverity::INFO:     level = LogLevel::INFO; break;
+        case data::ErrorSeverity::WARNING:  level = LogLevel::WARNING; break;
+        case data::ErrorSeverity::ERROR:    level = LogLevel::ERROR; break;
+        default:                            level = LogLevel::CRITICAL; break;
+    }
 
-    // For FATAL and CRITICAL errors, output to stderr
-    if (severity >= data::ErrorSeverity::CRITICAL) {
-        std::cerr << formatted_message << std::endl;
-    } else {
-        std::cout << formatted_message << std::endl;
+    if (Logger::isEnabled(level)) {
+        Logger::write(level, nullptr, formatted_message);
     }
 }
 
@@ -6,7 +6,9 @@
  */
 
 #include "utils/json_serializer.hpp"
+#include "utils/json_writer.hpp"
 #include "constants/message.hpp"
+#include <array>
 #include <sstream>
 
 namespace siren::utils {
@@ -14,13 +16,49 @@ namespace siren::utils {
 namespace constants = siren::constants;
 
 std::string JsonSerializer::serialize(const data::SonarDataPoint& data) {
+    // Hot path: compile-time schema, to_chars into a stack buffer
+    std::array<char, JsonSchema<data::SonarDataPoint>::MAX_SIZE> buffer;
+    const size_t size = serializeJson(data, buffer.data(), buffer.size());
+    return std::string(buffer.data(), size);
+}
+
+std::string JsonSerializer::serialize(const data::SonarBatch& batch) {
+    std::ostringstream oss;
+    oss << "{"
+        << formatField(constants::message::json_fields::TYPE, constants::message::json_types::SONAR_BATCH, true) << ","
+        << formatField(constants::message::json_fields::SWEEP, batch.sweep_count) << ","
+        << formatField(constants::message::json_fields::SWEEP_COMPLETE, batch.sweep_complete ? "true" : "false") << ","
+        << formatPoints(constants::message::json_fields::POINTS, batch.points)
+        << "}";
+    return oss.str();
+}
+
+std::string JsonSerializer::serialize(const data::ScanSnapshot& snapshot) {
+    std::ostringstream oss;
+    oss << "{"
+        << formatField(constants::message::json_fields::TYPE, constants::message::json_types::SCAN_SNAPSHOT, true) << ","
+        << formatPoints(constants::message::json_fields::POINTS, snapshot.points)
+        << "}";
+    return oss.str();
+}
+
+std::string JsonSerializer::serialize(const data::SonarReplay& replay) {
+    std::ostringstream oss;
+    oss << "{"
+        << formatField(constants::message::json_fields::TYPE, constants::message::json_types::SONAR_REPLAY, true) << ","
+        << formatPoints(constants::message::json_fields::POINTS, replay.points)
+        << "}";
+    return oss.str();
+}
+
+std::string JsonSerializer::serialize(const data::EnvironmentalData& environment) {
     std::ostringstream oss;
     oss << "{"
-        << formatField(constants::message::json_fields::TYPE, constants::message::json_types::SONAR_DATA, true) << ","
-        << formatField(constants::message::json_fields::TIMESTAMP, data.timestamp_us) << ","
-        << formatField(constants::message::json_fields::ANGLE, data.angle) << ","
-        << formatField(constants::message::json_fields::DISTANCE, data.distance) << ","
-        << formatField(constants::message::json_fields::QUALITY, static_cast<int>(data.quality))
+        << formatField(constants::message::json_fields::TYPE, constants::message::json_types::ENVIRONMENT_DATA, true) << ","
+        << formatField(constants::message::json_fields::TIMESTAMP, environment.timestamp_us) << ","
+        << formatField(constants::message::json_fields::TEMPERATURE_C, static_cast<double>(environment.temperature_c)) << ","
+        << formatField(constants::message::json_fields::HUMIDITY_PERCENT, static_cast<double>(environment.humidity_percent)) << ","
+        << formatField(constants::message::json_fields::SOUND_SPEED_CM_PER_US, static_cast<double>(environment.sound_speed_cm_per_us))
         << "}";
     return oss.str();
 }
@@ -34,7 +72,12 @@ std::string JsonSerializer::serialize(const data::PerformanceMetrics& metrics) {
         << formatField(constants::message::json_fields::MAX_LATENCY_US, metrics.max_latency_us) << ","
         << formatField(constants::message::json_fields::MEMORY_USAGE_BYTES, metrics.memory_usage_bytes) << ","
         << formatField(constants::message::json_fields::ACTIVE_CONNECTIONS, metrics.active_connections) << ","
-        << formatField(constants::message::json_fields::SERIAL_STATUS, static_cast<int>(metrics.serial_status))
+        << formatField(constants::message::json_fields::SERIAL_STATUS, static_cast<int>(metrics.serial_status)) << ","
+        << formatLatency(constants::message::json_fields::PROCESSING_LATENCY, metrics.processing_latency) << ","
+        << formatLatency(constants::message::json_fields::SERIAL_TO_BROADCAST_LATENCY, metrics.serial_to_broadcast_latency) << ","
+        << formatLatency(constants::message::json_fields::SESSION_WRITE_LATENCY, metrics.session_write_latency) << ","
+        << formatQueues(constants::message::json_fields::CLIENT_QUEUES, metrics.client_queues) << ","
+        << formatSessionQueues(constants::message::json_fields::SESSION_QUEUES, metrics.session_queues)
         << "}";
     return oss.str();
 }
@@ -137,6 +180,73 @@ std::string JsonSerializer::formatField(const char* key, const char* value, bool
     return formatField<const char*>(key, value, is_string);
 }
 
+std::string JsonSerializer::formatLatency(const char* key, const data::LatencyPercentiles& latency) {
+    std::ostringstream oss;
+    oss << "\"" << key << "\":{"
+        << formatField(constants::message::json_fields::P50_US, latency.p50_us) << ","
+        << formatField(constants::message::json_fields::P99_US, latency.p99_us) << ","
+        << formatField(constants::message::json_fields::P999_US, latency.p999_us) << ","
+        << formatField(constants::message::json_fields::MAX_US, latency.max_us) << ","
+        << formatField(constants::message::json_fields::SAMPLES, latency.samples)
+        << "}";
+    return oss.str();
+}
+
+std::string JsonSerializer::formatPoints(const char* key, const std::vector<data::SonarDataPoint>& points) {
+    using PointSchema = JsonSchema<data::SonarDataPoint>;
+
+    std::string out;
+    out.reserve(std::char_traits<char>::length(key) + points.size() * (PointSchema::MAX_SIZE / 2));
+    out.append("\"").append(key).append("\":[");
+
+    std::array<char, PointSchema::MAX_SIZE> buffer;
+    for (size_t i = 0; i < points.size(); ++i) {
+        JsonWriter writer(buffer.data(), buffer.size());
+        PointSchema::writeRecord(points[i], writer);
+        if (i != 0) {
+            out.push_back(',');
+        }
+        out.append(writer.view());
+    }
+    out.push_back(']');
+    return out;
+}
+
+std::string JsonSerializer::formatQueues(const char* key, const data::QueueStatistics& queues) {
+    std::ostringstream oss;
+    oss << "\"" << key << "\":{"
+        << formatField(constants::message::json_fields::BYTES_QUEUED, static_cast<uint64_t>(queues.bytes_queued)) << ","
+        << formatField(constants::message::json_fields::PEAK_BYTES_QUEUED, static_cast<uint64_t>(queues.peak_bytes_queued)) << ","
+        << formatField(constants::message::json_fields::MESSAGES_DROPPED, queues.messages_dropped) << ","
+        << formatField(constants::message::json_fields::MESSAGES_CONFLATED, queues.messages_conflated) << ","
+        << formatField(constants::message::json_fields::MESSAGES_DECIMATED, queues.messages_decimated) << ","
+        << formatField(constants::message::json_fields::DECIMATION_FACTOR, queues.decimation_factor)
+        << "}";
+    return oss.str();
+}
+
+std::string JsonSerializer::formatSessionQueues(const char* key,
+                                                const std::vector<data::SessionQueueStatistics>& sessions) {
+    std::ostringstream oss;
+    oss << "\"" << key << "\":[";
+    for (size_t i = 0; i < sessions.size(); ++i) {
+        const data::SessionQueueStatistics& session = sessions[i];
+        if (i != 0) {
+            oss << ",";
+        }
+        oss << "{"
+            << formatField(constants::message::json_fields::ENDPOINT, session.endpoint, true) << ","
+            << formatField(constants::message::json_fields::POLICY, session.policy, true) << ","
+            << formatField(constants::message::json_fields::BYTES_QUEUED, static_cast<uint64_t>(session.queues.bytes_queued)) << ","
+            << formatField(constants::message::json_fields::MESSAGES_DROPPED, session.queues.messages_dropped) << ","
+            << formatField(constants::message::json_fields::MESSAGES_CONFLATED, session.queues.messages_conflated) << ","
+            << formatField(constants::message::json_fields::MESSAGES_DECIMATED, session.queues.messages_decimated)
+            << "}";
+    }
+    oss << "]";
+    return oss.str();
+}
+
 std::string JsonSerializer::formatTimestamp(const std::chrono::steady_clock::time_point& timestamp) {
     auto timestamp_us = std::chrono::duration_cast<std::chrono::microseconds>(
         timestamp.time_since_epoch()).count();
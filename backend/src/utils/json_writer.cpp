@@ -0,0 +1,51 @@
+/**
+ * @file json_writer.cpp
+ * @brief Compile-time JSON schemas for allocation-free serialization
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "utils/json_writer.hpp"
+
+namespace siren::utils {
+
+// SSOT field names assembled into constant fragments (MISRA C++ Rule 5.0.1)
+namespace {
+    namespace fields = siren::constants::message::json_fields;
+    namespace types = siren::constants::message::json_types;
+
+    constexpr JsonFragment SONAR_OPEN = makeFragment(
+        {"{\"", fields::TYPE, "\":\"", types::SONAR_DATA, "\",\"", fields::TIMESTAMP, "\":"});
+    constexpr JsonFragment RECORD_OPEN = makeFragment({"{\"", fields::TIMESTAMP, "\":"});
+    constexpr JsonFragment ANGLE_KEY = makeFragment({",\"", fields::ANGLE, "\":"});
+    constexpr JsonFragment DISTANCE_KEY = makeFragment({",\"", fields::DISTANCE, "\":"});
+    constexpr JsonFragment QUALITY_KEY = makeFragment({",\"", fields::QUALITY, "\":"});
+    constexpr JsonFragment SEQUENCE_KEY = makeFragment({",\"", fields::SEQUENCE, "\":"});
+    constexpr std::string_view OBJECT_CLOSE = "}";
+
+    /// Everything after the opening fragment, shared by message and record form
+    void writeSonarFields(const data::SonarDataPoint& point, JsonWriter& writer) noexcept {
+        writer.integer(point.timestamp_us);
+        writer.literal(ANGLE_KEY.view());
+        writer.integer(point.angle);
+        writer.literal(DISTANCE_KEY.view());
+        writer.integer(point.distance);
+        writer.literal(QUALITY_KEY.view());
+        writer.integer(static_cast<int>(point.quality));
+        writer.literal(SEQUENCE_KEY.view());
+        writer.integer(point.sequence);
+        writer.literal(OBJECT_CLOSE);
+    }
+}
+
+void JsonSchema<data::SonarDataPoint>::write(const data::SonarDataPoint& point, JsonWriter& writer) noexcept {
+    writer.literal(SONAR_OPEN.view());
+    writeSonarFields(point, writer);
+}
+
+void JsonSchema<data::SonarDataPoint>::writeRecord(const data::SonarDataPoint& point, JsonWriter& writer) noexcept {
+    writer.literal(RECORD_OPEN.view());
+    writeSonarFields(point, writer);
+}
+
+} // namespace siren::utils
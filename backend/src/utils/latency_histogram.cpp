@@ -0,0 +1,178 @@
+/**
+ * @file latency_histogram.cpp
+ * @brief Implementation of log-linear latency histogram and sliding window
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "utils/latency_histogram.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace siren::utils {
+
+// SSOT for reported percentiles (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr double P50 = 50.0;
+    constexpr double P99 = 99.0;
+    constexpr double P999 = 99.9;
+    constexpr double PERCENT = 100.0;
+    constexpr uint32_t MSB_INDEX = 63;
+
+    void updateMax(std::atomic<uint64_t>& max, uint64_t value) noexcept {
+        uint64_t current = max.load(std::memory_order_relaxed);
+        while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+}
+
+LatencyHistogram::LatencyHistogram() noexcept
+    : counts_()
+    , count_(0)
+    , total_(0)
+    , max_(0)
+{
+    reset();
+}
+
+size_t LatencyHistogram::bucketIndex(uint64_t value_us) noexcept {
+    const uint64_t value = std::min(value_us, MAX_VALUE);
+    const uint32_t magnitude = MSB_INDEX - static_cast<uint32_t>(__builtin_clzll(value | 1));
+    const uint32_t shift = (magnitude > SUB_BUCKET_BITS) ? (magnitude - SUB_BUCKET_BITS) : 0;
+    return static_cast<size_t>(shift * SUB_BUCKET_COUNT + (value >> shift));
+}
+
+uint64_t LatencyHistogram::bucketUpperBound(size_t index) noexcept {
+    if (index < 2 * SUB_BUCKET_COUNT) {
+        return index; // Exact region
+    }
+    const uint64_t shift = index / SUB_BUCKET_COUNT - 1;
+    const uint64_t sub_bucket = index - shift * SUB_BUCKET_COUNT;
+    return ((sub_bucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t value_us) noexcept {
+    counts_[bucketIndex(value_us)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    total_.fetch_add(value_us, std::memory_order_relaxed);
+    updateMax(max_, value_us);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) noexcept {
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        const uint64_t count = other.counts_[i].load(std::memory_order_relaxed);
+        if (count != 0) {
+            counts_[i].fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+    count_.fetch_add(other.count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    total_.fetch_add(other.total_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    updateMax(max_, other.max_.load(std::memory_order_relaxed));
+}
+
+void LatencyHistogram::drainInto(LatencyHistogram& target) noexcept {
+    uint64_t moved = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        if (counts_[i].load(std::memory_order_relaxed) != 0) {
+            const uint64_t count = counts_[i].exchange(0, std::memory_order_relaxed);
+            target.counts_[i].fetch_add(count, std::memory_order_relaxed);
+            moved += count;
+        }
+    }
+
+    // Count follows the buckets actually moved so percentiles stay consistent
+    count_.fetch_sub(moved, std::memory_order_relaxed);
+    target.count_.fetch_add(moved, std::memory_order_relaxed);
+    target.total_.fetch_add(total_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    updateMax(target.max_, max_.exchange(0, std::memory_order_relaxed));
+}
+
+void LatencyHistogram::reset() noexcept {
+    for (auto& count : counts_) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    total_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getCount() const noexcept {
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getTotal() const noexcept {
+    return total_.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getMax() const noexcept {
+    return max_.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::countAbove(uint64_t value_us) const noexcept {
+    uint64_t above = 0;
+    for (size_t i = bucketIndex(value_us) + 1; i < BUCKET_COUNT; ++i) {
+        above += counts_[i].load(std::memory_order_relaxed);
+    }
+    return above;
+}
+
+uint64_t LatencyHistogram::valueAtPercentile(double percentile) const noexcept {
+    const uint64_t count = getCount();
+    if (count == 0) {
+        return 0;
+    }
+
+    const double fraction = std::clamp(percentile, 0.0, PERCENT) / PERCENT;
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(count))));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += counts_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(bucketUpperBound(i), getMax());
+        }
+    }
+    return getMax();
+}
+
+data::LatencyPercentiles LatencyHistogram::summarize() const noexcept {
+    data::LatencyPercentiles result;
+    result.p50_us = static_cast<uint32_t>(valueAtPercentile(P50));
+    result.p99_us = static_cast<uint32_t>(valueAtPercentile(P99));
+    result.p999_us = static_cast<uint32_t>(valueAtPercentile(P999));
+    result.max_us = static_cast<uint32_t>(std::min(getMax(), MAX_VALUE));
+    result.samples = getCount();
+    return result;
+}
+
+SlidingLatencyWindow::SlidingLatencyWindow()
+    : intervals_()
+    , merged_(std::make_unique<LatencyHistogram>())
+    , current_(0)
+{
+    for (auto& interval : intervals_) {
+        interval = std::make_unique<LatencyHistogram>();
+    }
+}
+
+LatencyHistogram& SlidingLatencyWindow::beginInterval() noexcept {
+    current_ = (current_ + 1) % INTERVAL_COUNT;
+    intervals_[current_]->reset();
+    return *intervals_[current_];
+}
+
+data::LatencyPercentiles SlidingLatencyWindow::summarize() noexcept {
+    merged_->reset();
+    for (const auto& interval : intervals_) {
+        merged_->merge(*interval);
+    }
+    return merged_->summarize();
+}
+
+void SlidingLatencyWindow::reset() noexcept {
+    for (auto& interval : intervals_) {
+        interval->reset();
+    }
+}
+
+} // namespace siren::utils
@@ -0,0 +1,30 @@
+/**
+ * @file latency_tracker.cpp
+ * @brief Implementation of process-wide latency recording
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "utils/latency_tracker.hpp"
+#include <array>
+
+namespace siren::utils {
+
+namespace {
+    constexpr size_t CHANNEL_COUNT = static_cast<size_t>(LatencyChannel::COUNT);
+
+    LatencyHistogram& channelHistogram(LatencyChannel channel) noexcept {
+        static std::array<LatencyHistogram, CHANNEL_COUNT> histograms;
+        return histograms[static_cast<size_t>(channel)];
+    }
+}
+
+void LatencyTracker::record(LatencyChannel channel, uint64_t duration_us) noexcept {
+    channelHistogram(channel).record(duration_us);
+}
+
+void LatencyTracker::drainInto(LatencyChannel channel, LatencyHistogram& target) noexcept {
+    channelHistogram(channel).drainInto(target);
+}
+
+} // namespace siren::utils
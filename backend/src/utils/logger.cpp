@@ -0,0 +1,329 @@
+/**
+ * @file logger.cpp
+ * @brief Implementation of asynchronous level-filtered logging
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Per-thread single-producer/single-consumer rings drained by one writer
+ * thread that batches output and flushes once per batch.
+ */
+
+#include "utils/logger.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace siren::utils {
+
+namespace cnst = siren::constants;
+
+// SSOT for logger internals (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr const char* COMPONENT_NAME = "Logger";
+    constexpr size_t RING_CAPACITY = cnst::error::logging::RING_CAPACITY_RECORDS;
+    constexpr size_t TEXT_SIZE = cnst::error::logging::RECORD_TEXT_SIZE;
+    constexpr size_t CACHE_LINE_SIZE = 64;
+    constexpr size_t NUMBER_BUFFER_SIZE = 32;
+
+    static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0, "Ring capacity must be a power of two");
+
+    /// One queued log line
+    struct Record {
+        uint64_t timestamp_ns;
+        const char* component;
+        uint16_t length;
+        LogLevel level;
+        char text[TEXT_SIZE];
+    };
+
+    /// Lock-free SPSC ring owned by one producer thread
+    class ThreadRing {
+    public:
+        ThreadRing() : head_(0), tail_(0), retired_(false) {}
+
+        bool tryPush(LogLevel level, const char* component, std::string_view text) noexcept {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            if (head - tail_.load(std::memory_order_acquire) == RING_CAPACITY) {
+                return false;
+            }
+
+            Record& record = slots_[head & (RING_CAPACITY - 1)];
+            record.timestamp_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+            record.component = component;
+            record.level = level;
+            record.length = static_cast<uint16_t>(std::min(text.size(), TEXT_SIZE));
+            std::memcpy(record.text, text.data(), record.length);
+
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        template <typename Sink>
+        size_t drain(Sink&& sink) {
+            size_t tail = tail_.load(std::memory_order_relaxed);
+            const size_t head = head_.load(std::memory_order_acquire);
+            const size_t count = head - tail;
+            for (; tail != head; ++tail) {
+                sink(slots_[tail & (RING_CAPACITY - 1)]);
+            }
+            tail_.store(tail, std::memory_order_release);
+            return count;
+        }
+
+        bool empty() const noexcept {
+            return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+        }
+
+        void retire() noexcept { retired_.store(true, std::memory_order_release); }
+        bool retired() const noexcept { return retired_.load(std::memory_order_acquire); }
+
+    private:
+        std::array<Record, RING_CAPACITY> slots_;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_;
+        std::atomic<bool> retired_;
+    };
+
+    /// Shared logger state
+    struct LoggerState {
+        std::mutex registry_mutex;
+        std::vector<std::shared_ptr<ThreadRing>> rings;
+
+        std::mutex sync_mutex;          ///< Serializes synchronous output when no writer runs
+        std::mutex writer_mutex;
+        std::condition_variable writer_cv;
+        std::thread writer;
+        std::atomic<bool> running{false};
+        std::atomic<uint64_t> dropped{0};
+    };
+
+    LoggerState& state() {
+        static LoggerState instance;
+        return instance;
+    }
+
+    /// Registers this thread's ring on first use, retires it on thread exit
+    struct ThreadRingHandle {
+        std::shared_ptr<ThreadRing> ring;
+
+        ThreadRing& get() {
+            if (!ring) {
+                ring = std::make_shared<ThreadRing>();
+                std::lock_guard<std::mutex> lock(state().registry_mutex);
+                state().rings.push_back(ring);
+            }
+            return *ring;
+        }
+
+        ~ThreadRingHandle() {
+            if (ring) {
+                ring->retire();
+            }
+        }
+    };
+
+    thread_local ThreadRingHandle t_ring;
+
+    /// Append "[component] text\n" to an output buffer
+    void formatLine(std::string& out, const char* component, std::string_view text) {
+        if (component != nullptr) {
+            out += '[';
+            out += component;
+            out += "] ";
+        }
+        out.append(text.data(), text.size());
+        out += '\n';
+    }
+
+    void emit(std::string& out, std::FILE* stream) {
+        if (!out.empty()) {
+            std::fwrite(out.data(), 1, out.size(), stream);
+            std::fflush(stream);
+            out.clear();
+        }
+    }
+
+    /// Drain every ring once; returns number of records written
+    size_t drainAll(std::vector<Record>& batch, std::string& out, std::string& err) {
+        LoggerState& s = state();
+        batch.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(s.registry_mutex);
+            for (const auto& ring : s.rings) {
+                ring->drain([&batch](const Record& record) { batch.push_back(record); });
+            }
+            // Forget rings of exited threads once they are empty
+            s.rings.erase(std::remove_if(s.rings.begin(), s.rings.end(),
+                [](const std::shared_ptr<ThreadRing>& ring) { return ring->retired() && ring->empty(); }),
+                s.rings.end());
+        }
+
+        // Restore global order across threads
+        std::stable_sort(batch.begin(), batch.end(),
+            [](const Record& a, const Record& b) { return a.timestamp_ns < b.timestamp_ns; });
+
+        for (const Record& record : batch) {
+            formatLine(record.level >= LogLevel::CRITICAL ? err : out, record.component,
+                       std::string_view(record.text, record.length));
+        }
+        emit(err, stderr);
+        emit(out, stdout);
+        return batch.size();
+    }
+
+    void writerLoop() {
+        LoggerState& s = state();
+        std::vector<Record> batch;
+        batch.reserve(RING_CAPACITY);
+        std::string out;
+        std::string err;
+        uint64_t reported_drops = 0;
+
+        while (s.running.load(std::memory_order_acquire)) {
+            if (drainAll(batch, out, err) == 0) {
+                std::unique_lock<std::mutex> lock(s.writer_mutex);
+                s.writer_cv.wait_for(lock, cnst::error::logging::WRITER_POLL_INTERVAL);
+            }
+
+            const uint64_t drops = s.dropped.load(std::memory_order_relaxed);
+            if (drops != reported_drops) {
+                out = "[" + std::string(COMPONENT_NAME) + "] ⚠️ " + std::to_string(drops - reported_drops) +
+                      " log records dropped (ring full)\n";
+                emit(out, stdout);
+                reported_drops = drops;
+            }
+        }
+
+        // Final drain after shutdown request
+        drainAll(batch, out, err);
+    }
+}
+
+void Logger::start() {
+    LoggerState& s = state();
+    if (s.running.exchange(true)) {
+        return; // Already running
+    }
+    s.writer = std::thread(writerLoop);
+
+    // Join the writer before static state is destroyed, even on early exit paths
+    static std::once_flag exit_hook;
+    std::call_once(exit_hook, []() { std::atexit([]() { Logger::shutdown(); }); });
+}
+
+void Logger::shutdown() noexcept {
+    LoggerState& s = state();
+    if (!s.running.exchange(false)) {
+        return;
+    }
+    s.writer_cv.notify_all();
+    if (s.writer.joinable()) {
+        s.writer.join();
+    }
+}
+
+void Logger::setLevel(LogLevel level) noexcept {
+    runtime_level_.store(level, std::memory_order_relaxed);
+}
+
+LogLevel Logger::getLevel() noexcept {
+    return runtime_level_.load(std::memory_order_relaxed);
+}
+
+void Logger::write(LogLevel level, const char* component, std::string_view text) noexcept {
+    LoggerState& s = state();
+
+    if (!s.running.load(std::memory_order_acquire)) {
+        // No writer thread: synchronous fallback (startup, tools, benchmarks)
+        try {
+            std::string line;
+            formatLine(line, component, text);
+            std::lock_guard<std::mutex> lock(s.sync_mutex);
+            emit(line, level >= LogLevel::CRITICAL ? stderr : stdout);
+        } catch (...) {
+            // Logging must never throw into callers
+        }
+        return;
+    }
+
+    try {
+        if (!t_ring.get().tryPush(level, component, text)) {
+            s.dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    } catch (...) {
+        s.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint64_t Logger::getDroppedCount() noexcept {
+    return state().dropped.load(std::memory_order_relaxed);
+}
+
+bool Logger::parseLevel(std::string_view name, LogLevel& level) noexcept {
+    constexpr std::array<std::pair<std::string_view, LogLevel>, 6> LEVEL_NAMES = {{
+        {"debug", LogLevel::DEBUG},
+        {"info", LogLevel::INFO},
+        {"warning", LogLevel::WARNING},
+        {"error", LogLevel::ERROR},
+        {"critical", LogLevel::CRITICAL},
+        {"off", LogLevel::OFF},
+    }};
+
+    for (const auto& [level_name, value] : LEVEL_NAMES) {
+        if (name == level_name) {
+            level = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+LogStream& LogStream::operator<<(std::string_view text) noexcept {
+    const size_t count = std::min(text.size(), text_.size() - length_);
+    std::memcpy(text_.data() + length_, text.data(), count);
+    length_ += count;
+    return *this;
+}
+
+LogStream& LogStream::operator<<(const char* text) noexcept {
+    return *this << std::string_view(text != nullptr ? text : "(null)");
+}
+
+LogStream& LogStream::operator<<(const std::string& text) noexcept {
+    return *this << std::string_view(text);
+}
+
+LogStream& LogStream::operator<<(char c) noexcept {
+    return *this << std::string_view(&c, 1);
+}
+
+LogStream& LogStream::operator<<(double value) noexcept {
+    // Same rendering as std::ostream default (%g, precision 6)
+    std::array<char, NUMBER_BUFFER_SIZE> buffer;
+    const int length = std::snprintf(buffer.data(), buffer.size(), "%g", value);
+    return *this << std::string_view(buffer.data(), static_cast<size_t>(std::max(0, length)));
+}
+
+LogStream& LogStream::appendSigned(long long value) noexcept {
+    std::array<char, NUMBER_BUFFER_SIZE> buffer;
+    const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    return *this << std::string_view(buffer.data(), static_cast<size_t>(result.ptr - buffer.data()));
+}
+
+LogStream& LogStream::appendUnsigned(unsigned long long value) noexcept {
+    std::array<char, NUMBER_BUFFER_SIZE> buffer;
+    const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    return *this << std::string_view(buffer.data(), static_cast<size_t>(result.ptr - buffer.data()));
+}
+
+} // namespace siren::utils
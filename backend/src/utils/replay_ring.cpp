@@ -0,0 +1,67 @@
+/**
+ * @file replay_ring.cpp
+ * @brief Implementation of the sonar sample replay ring
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "utils/replay_ring.hpp"
+#include <algorithm>
+
+namespace siren::utils {
+
+ReplayRing::ReplayRing()
+    : ring_mutex_()
+    , slots_(CAPACITY)
+    , next_(0)
+    , count_(0)
+{
+}
+
+void ReplayRing::push(const data::SonarDataPoint& point) {
+    std::lock_guard<std::mutex> lock(ring_mutex_);
+    slots_[next_] = point;
+    next_ = (next_ + 1) % CAPACITY;
+    count_ = std::min(count_ + 1, CAPACITY);
+}
+
+bool ReplayRing::collect(uint32_t last_sequence, uint64_t now_us, data::SonarReplay& replay) const {
+    namespace resume = constants::communication::resume;
+
+    replay.points.clear();
+
+    std::lock_guard<std::mutex> lock(ring_mutex_);
+    if (count_ == 0) {
+        return false;
+    }
+
+    // A sequence number ahead of ours comes from before a server restart
+    const data::SonarDataPoint& newest = slots_[(next_ + CAPACITY - 1) % CAPACITY];
+    if (isAfter(last_sequence, newest.sequence)) {
+        return false;
+    }
+
+    // Walk back from the newest sample until the client's last one
+    for (size_t age = 0; age < count_; ++age) {
+        const data::SonarDataPoint& point = slots_[(next_ + CAPACITY - 1 - age) % CAPACITY];
+        if (!isAfter(point.sequence, last_sequence)) {
+            std::reverse(replay.points.begin(), replay.points.end());
+            return true;
+        }
+        if (replay.points.size() >= resume::MAX_REPLAY_POINTS
+            || point.timestamp_us + resume::WINDOW_US < now_us) {
+            break;
+        }
+        replay.points.push_back(point);
+    }
+
+    // Start of the gap is no longer held
+    replay.points.clear();
+    return false;
+}
+
+bool ReplayRing::isAfter(uint32_t a, uint32_t b) noexcept {
+    return static_cast<int32_t>(a - b) > 0;
+}
+
+} // namespace siren::utils
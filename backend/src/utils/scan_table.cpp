@@ -0,0 +1,44 @@
+/**
+ * @file scan_table.cpp
+ * @brief Implementation of the latest-reading-per-angle table
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "utils/scan_table.hpp"
+
+namespace siren::utils {
+
+ScanTable::ScanTable()
+    : table_mutex_()
+    , latest_()
+    , occupied_()
+{
+}
+
+void ScanTable::update(const data::SonarDataPoint& point) {
+    if (point.angle < 0 || static_cast<size_t>(point.angle) >= ANGLE_BIN_COUNT) {
+        return;
+    }
+
+    const size_t bin = static_cast<size_t>(point.angle);
+    std::lock_guard<std::mutex> lock(table_mutex_);
+    latest_[bin] = point;
+    occupied_.set(bin);
+}
+
+data::ScanSnapshot ScanTable::snapshot(uint64_t now_us, uint64_t max_age_us) const {
+    data::ScanSnapshot snapshot;
+    snapshot.points.reserve(ANGLE_BIN_COUNT);
+
+    std::lock_guard<std::mutex> lock(table_mutex_);
+    for (size_t bin = 0; bin < ANGLE_BIN_COUNT; ++bin) {
+        const data::SonarDataPoint& point = latest_[bin];
+        if (occupied_.test(bin) && (point.timestamp_us + max_age_us >= now_us)) {
+            snapshot.points.push_back(point);
+        }
+    }
+    return snapshot;
+}
+
+} // namespace siren::utils
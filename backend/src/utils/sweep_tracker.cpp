@@ -0,0 +1,57 @@
+/**
+ * @file sweep_tracker.cpp
+ * @brief Implementation of servo sweep detection
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "utils/sweep_tracker.hpp"
+#include "constants/hardware.hpp"
+#include <chrono>
+
+namespace siren::utils {
+
+SweepTracker::SweepTracker()
+    : state_()
+    , has_position_(false)
+{
+    // No direction until the servo has moved once
+    state_.direction = data::SweepDirection::STATIONARY;
+}
+
+bool SweepTracker::update(int16_t angle) {
+    if (!has_position_) {
+        has_position_ = true;
+        state_.current_angle = angle;
+        state_.target_angle = angle;
+        return false;
+    }
+
+    if (angle == state_.current_angle) {
+        return false; // Repeated reading at the same position
+    }
+
+    const data::SweepDirection direction = (angle > state_.current_angle)
+        ? data::SweepDirection::FORWARD
+        : data::SweepDirection::BACKWARD;
+    const bool reversed = (state_.direction != data::SweepDirection::STATIONARY)
+        && (direction != state_.direction);
+
+    state_.direction = direction;
+    state_.current_angle = angle;
+    state_.target_angle = (direction == data::SweepDirection::FORWARD)
+        ? constants::hardware::servo::MAX_ANGLE_DEGREES
+        : constants::hardware::servo::MIN_ANGLE_DEGREES;
+    state_.last_movement = std::chrono::steady_clock::now();
+
+    if (reversed) {
+        ++state_.sweep_count;
+    }
+    return reversed;
+}
+
+const data::SweepState& SweepTracker::getState() const noexcept {
+    return state_;
+}
+
+} // namespace siren::utils
@@ -11,7 +11,8 @@
 #include "constants/communication.hpp"
 #include "constants/message.hpp"
 #include "utils/error_handler.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
+#include "utils/latency_tracker.hpp"
 
 namespace siren::websocket {
 
@@ -32,7 +33,7 @@ ConnectionAcceptor::ConnectionAcceptor(boost::asio::io_context& io_context, uint
     , accept_callback_(nullptr)
     , error_callback_(nullptr)
 {
-    std::cout << "[" << COMPONENT_NAME << "] Initializing TCP acceptor on port " << port_ << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing TCP acceptor on port " << port_);
 }
 
 ConnectionAcceptor::~ConnectionAcceptor() {
@@ -43,8 +44,8 @@ ConnectionAcceptor::~ConnectionAcceptor() {
 
 bool ConnectionAcceptor::initialize() {
     try {
-        // Create TCP acceptor (RAII managed)
-        acceptor_ = std::make_unique<tcp::acceptor>(io_context_);
+        // Create TCP acceptor (RAII managed) on its own strand
+        acceptor_ = std::make_unique<tcp::acceptor>(boost::asio::make_strand(io_context_));
 
         // Configure acceptor endpoint
         tcp::endpoint endpoint(tcp::v4(), port_);
@@ -61,8 +62,8 @@ bool ConnectionAcceptor::initialize() {
         // Start listening
         acceptor_->listen(ACCEPTOR_BACKLOG);
 
-        std::cout << "[" << COMPONENT_NAME << "] Initialized on "
-                  << endpoint.address().to_string() << ":" << endpoint.port() << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Initialized on "
+                                       << endpoint.address().to_string() << ":" << endpoint.port());
         return true;
 
     } catch (const std::exception& e) {
@@ -94,8 +95,8 @@ bool ConnectionAcceptor::start() {
         // Start accepting connections
         startAccept();
 
-        std::cout << "[" << COMPONENT_NAME << "] Started accepting connections on port "
-                  << port_ << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Started accepting connections on port "
+                                       << port_);
         return true;
 
     } catch (const std::exception& e) {
@@ -111,7 +112,7 @@ void ConnectionAcceptor::stop() {
         return;
     }
 
-    std::cout << "[" << COMPONENT_NAME << "] Stopping connection acceptor..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Stopping connection acceptor...");
 
     shutdown_requested_.store(true);
     running_.store(false);
@@ -126,7 +127,7 @@ void ConnectionAcceptor::stop() {
         }
     }
 
-    std::cout << "[" << COMPONENT_NAME << "] Stopped" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Stopped");
 }
 
 bool ConnectionAcceptor::isRunning() const noexcept {
@@ -146,9 +147,11 @@ void ConnectionAcceptor::startAccept() {
         return;
     }
 
-    // Start async accept operation
+    // Start async accept operation; each accepted socket gets its own strand
     acceptor_->async_accept(
+        boost::asio::make_strand(io_context_),
         [this](beast::error_code ec, tcp::socket socket) {
+            utils::ScopedHandlerTimer timer;
             onAccept(ec, std::move(socket));
         });
 }
@@ -167,8 +170,8 @@ void ConnectionAcceptor::onAccept(beast::error_code ec, tcp::socket socket) {
     // Successfully accepted connection
     try {
         auto endpoint = socket.remote_endpoint();
-        std::cout << "[" << COMPONENT_NAME << "] Accepted connection from "
-                  << endpoint.address().to_string() << ":" << endpoint.port() << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Accepted connection from "
+                                       << endpoint.address().to_string() << ":" << endpoint.port());
 
         // Notify parent via callback (SSOT for notification)
         if (accept_callback_) {
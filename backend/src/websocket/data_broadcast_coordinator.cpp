@@ -10,7 +10,9 @@
 #include "websocket/data_broadcast_coordinator.hpp"
 #include "websocket/session_manager.hpp"
 #include "websocket/message_broadcaster.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
+#include "utils/latency_tracker.hpp"
+#include <chrono>
 
 namespace siren::websocket {
 
@@ -24,8 +26,12 @@ DataBroadcastCoordinator::DataBroadcastCoordinator(
     std::unique_ptr<MessageBroadcaster>& message_broadcaster)
     : session_manager_(session_manager)
     , message_broadcaster_(message_broadcaster)
+    , scan_table_()
+    , replay_ring_()
+    , point_changes_()
+    , batch_changes_()
 {
-    std::cout << "[" << COMPONENT_NAME << "] Initializing data broadcast coordinator" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing data broadcast coordinator");
 }
 
 void DataBroadcastCoordinator::broadcastSonarData(const data::SonarDataPoint& data,
@@ -34,11 +40,56 @@ void DataBroadcastCoordinator::broadcastSonarData(const data::SonarDataPoint& da
         return;
     }
 
-    // Get active sessions from session manager
-    auto active_sessions = session_manager_->getActiveSessions();
+    // Late joiners start from the latest reading at every angle
+    scan_table_.update(data);
+
+    // Reconnecting clients catch up from here
+    replay_ring_.push(data);
+
+    // Delta-encoded clients only need the point if it changed
+    const bool changed = point_changes_.update(data);
+
+    // Snapshot of active sessions (no copy, no lock)
+    const auto active_sessions = session_manager_->getActiveSessions();
 
     // Broadcast through message broadcaster
-    message_broadcaster_->broadcastSonarData(data, active_sessions);
+    message_broadcaster_->broadcastSonarData(data, changed, *active_sessions);
+
+    // Sample timestamp is taken at parse time on the same steady clock
+    const auto now_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    if (now_us >= data.timestamp_us) {
+        utils::LatencyTracker::record(utils::LatencyChannel::SERIAL_TO_BROADCAST, now_us - data.timestamp_us);
+    }
+}
+
+void DataBroadcastCoordinator::broadcastSonarBatch(const data::SonarBatch& batch,
+                                                   const std::atomic<bool>& running) {
+    if (!running.load() || !message_broadcaster_) {
+        return;
+    }
+
+    // Delta-encoded clients get the batch reduced to points that changed
+    const data::SonarBatch delta_batch = batch_changes_.reduce(batch);
+
+    // Snapshot of active sessions (no copy, no lock)
+    const auto active_sessions = session_manager_->getActiveSessions();
+
+    // Broadcast through message broadcaster
+    message_broadcaster_->broadcastSonarBatch(batch, delta_batch, *active_sessions);
+}
+
+void DataBroadcastCoordinator::broadcastEnvironmentData(const data::EnvironmentalData& environment,
+                                                        const std::atomic<bool>& running) {
+    if (!running.load() || !message_broadcaster_) {
+        return;
+    }
+
+    // Snapshot of active sessions (no copy, no lock)
+    const auto active_sessions = session_manager_->getActiveSessions();
+
+    // Broadcast through message broadcaster
+    message_broadcaster_->broadcastEnvironmentData(environment, *active_sessions);
 }
 
 void DataBroadcastCoordinator::broadcastPerformanceMetrics(const data::PerformanceMetrics& metrics,
@@ -47,11 +98,31 @@ void DataBroadcastCoordinator::broadcastPerformanceMetrics(const data::Performan
         return;
     }
 
-    // Get active sessions from session manager
-    auto active_sessions = session_manager_->getActiveSessions();
+    // Snapshot of active sessions (no copy, no lock)
+    const auto active_sessions = session_manager_->getActiveSessions();
 
     // Broadcast through message broadcaster
-    message_broadcaster_->broadcastPerformanceMetrics(metrics, active_sessions);
+    message_broadcaster_->broadcastPerformanceMetrics(metrics, *active_sessions);
+}
+
+void DataBroadcastCoordinator::configureDeltaEncoding(int16_t threshold_cm, uint64_t keyframe_interval_us) {
+    point_changes_.configure(threshold_cm, keyframe_interval_us);
+    batch_changes_.configure(threshold_cm, keyframe_interval_us);
+
+    SIREN_LOG_INFO(COMPONENT_NAME, "Delta encoding: changes over " << threshold_cm
+                                   << "cm, keyframe every " << keyframe_interval_us << "μs per angle");
+}
+
+data::ScanSnapshot DataBroadcastCoordinator::getScanSnapshot() const {
+    const auto now_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    return scan_table_.snapshot(now_us, constants::communication::scan_snapshot::MAX_AGE_US);
+}
+
+bool DataBroadcastCoordinator::getReplay(uint32_t last_sequence, data::SonarReplay& replay) const {
+    const auto now_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+    return replay_ring_.collect(last_sequence, now_us, replay);
 }
 
 } // namespace siren::websocket
\ No newline at end of file
@@ -10,11 +10,139 @@
 #include "websocket/message_broadcaster.hpp"
 #include "websocket/server.hpp" // For WebSocketSession definition
 #include "utils/json_serializer.hpp"
+#include "utils/binary_serializer.hpp"
 #include "utils/error_handler.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
+#include <chrono>
 
 namespace siren::websocket {
 
+namespace {
+    /// Which encodings the current sessions need (each is serialized at most once)
+    struct ProtocolUsage {
+        bool json = false;
+        bool binary = false;
+    };
+
+    template <typename Accepts>
+    ProtocolUsage protocolUsage(const MessageBroadcaster::SessionContainer& sessions, Accepts accepts) {
+        ProtocolUsage usage;
+        for (const auto& session : sessions) {
+            if (session && session->isAlive() && accepts(*session, *session->getSubscription())) {
+                (session->usesBinaryProtocol() ? usage.binary : usage.json) = true;
+            }
+        }
+        return usage;
+    }
+
+    /// Predicate for messages every subscriber of a topic receives
+    auto subscribedTo(SubscriptionTopic topic) {
+        return [topic](const WebSocketSession&, const SubscriptionFilter& subscription) {
+            return subscription.acceptsTopic(topic);
+        };
+    }
+
+    /// Per-point sessions whose sectors and range gate contain the point (delta sessions only if it changed)
+    auto wantsSonarPoint(const data::SonarDataPoint& point, bool changed) {
+        return [&point, changed](const WebSocketSession& session, const SubscriptionFilter& subscription) {
+            return session.getSonarDelivery() == SonarDelivery::PER_POINT
+                && (changed || session.getSonarEncoding() == SonarEncoding::FULL)
+                && subscription.acceptsTopic(SubscriptionTopic::SONAR)
+                && subscription.acceptsPoint(point.angle, point.distance);
+        };
+    }
+
+    /// Per-batch sessions of one encoding that take whole batches (no sectors or range gate)
+    auto wantsSharedBatch(SonarEncoding encoding) {
+        return [encoding](const WebSocketSession& session, const SubscriptionFilter& subscription) {
+            return session.getSonarDelivery() == SonarDelivery::PER_BATCH
+                && session.getSonarEncoding() == encoding
+                && subscription.acceptsTopic(SubscriptionTopic::SONAR)
+                && !subscription.isSpatial();
+        };
+    }
+
+    /// Per-batch sessions that need the batch reduced to their own sectors and range gate
+    bool wantsFilteredBatch(const WebSocketSession& session, const SubscriptionFilter& subscription) {
+        return session.getSonarDelivery() == SonarDelivery::PER_BATCH
+            && subscription.acceptsTopic(SubscriptionTopic::SONAR)
+            && subscription.isSpatial();
+    }
+
+    uint64_t steadyNowUs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+}
+
+template <typename Accepts>
+void MessageBroadcaster::deliverMessage(const SharedMessage& json_message,
+                                        const SharedMessage& binary_message,
+                                        const SessionContainer& sessions,
+                                        SubscriptionTopic topic,
+                                        Accepts accepts) {
+    if (!running_.load()) {
+        return;
+    }
+
+    size_t sessions_reached = 0;
+    size_t total_sessions = 0;
+    const uint64_t now_us = steadyNowUs();
+
+    // Broadcast to each active session the message is meant for
+    for (const auto& session : sessions) {
+        if (!session || !session->isAlive()) {
+            continue;
+        }
+        const SubscriptionSnapshot subscription = session->getSubscription();
+        if (!accepts(*session, *subscription)) {
+            continue;
+        }
+
+        ++total_sessions;
+        if (!session->admitMessage(*subscription, topic, now_us)) {
+            continue; // Rate capped; not a failure
+        }
+        const SharedMessage& message = session->usesBinaryProtocol() ? binary_message : json_message;
+        if (message && sendToSession(session, message)) {
+            ++sessions_reached;
+        }
+    }
+
+    // Update statistics and notify completion
+    const bool success = (sessions_reached > 0 || total_sessions == 0);
+    updateBroadcastStats(success);
+    notifyBroadcastComplete(sessions_reached);
+
+    // Log broadcast results for debugging
+    if (total_sessions > 0) {
+        SIREN_LOG_DEBUG(COMPONENT_NAME, "Broadcast to " << sessions_reached
+                                        << "/" << total_sessions << " sessions");
+    }
+}
+
+template <typename Accepts>
+void MessageBroadcaster::deliverBatch(const data::SonarBatch& batch,
+                                      const SessionContainer& sessions,
+                                      Accepts accepts) {
+    if (batch.points.empty()) {
+        return;
+    }
+
+    // Serialize the batch once per protocol in use (SSOT for batch serialization)
+    const ProtocolUsage usage = protocolUsage(sessions, accepts);
+    if (!usage.json && !usage.binary) {
+        return;
+    }
+    const MessageTag tag = MessageTag::sonarBatch(batch.sweep_count, batch.points.back().sequence);
+    const SharedMessage json_message = usage.json
+        ? makeSharedMessage(utils::JsonSerializer::serialize(batch), FrameType::TEXT, tag) : nullptr;
+    const SharedMessage binary_message = usage.binary
+        ? makeSharedMessage(utils::BinarySerializer::serialize(batch), FrameType::BINARY, tag) : nullptr;
+
+    deliverMessage(json_message, binary_message, sessions, SubscriptionTopic::SONAR, accepts);
+}
+
 MessageBroadcaster::MessageBroadcaster()
     : running_(false)
     , initialized_(false)
@@ -22,7 +150,7 @@ MessageBroadcaster::MessageBroadcaster()
     , failed_broadcasts_(0)
     , broadcast_callback_(nullptr)
 {
-    std::cout << "[" << COMPONENT_NAME << "] Initializing message broadcaster" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing message broadcaster");
 }
 
 MessageBroadcaster::~MessageBroadcaster() {
@@ -46,7 +174,7 @@ bool MessageBroadcaster::initialize() {
 
         initialized_.store(true);
 
-        std::cout << "[" << COMPONENT_NAME << "] Initialized successfully" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Initialized successfully");
         return true;
 
     } catch (const std::exception& e) {
@@ -74,7 +202,7 @@ bool MessageBroadcaster::start() {
     try {
         running_.store(true);
 
-        std::cout << "[" << COMPONENT_NAME << "] Started successfully" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Started successfully");
         return true;
 
     } catch (const std::exception& e) {
@@ -89,13 +217,13 @@ void MessageBroadcaster::stop() {
         return;
     }
 
-    std::cout << "[" << COMPONENT_NAME << "] Stopping message broadcaster..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Stopping message broadcaster...");
 
     running_.store(false);
 
-    std::cout << "[" << COMPONENT_NAME << "] Stopped (broadcasts: "
-              << total_broadcasts_.load() << ", failures: "
-              << failed_broadcasts_.load() << ")" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Stopped (broadcasts: "
+                                   << total_broadcasts_.load() << ", failures: "
+                                   << failed_broadcasts_.load() << ")");
 }
 
 bool MessageBroadcaster::isRunning() const noexcept {
@@ -103,17 +231,27 @@ bool MessageBroadcaster::isRunning() const noexcept {
 }
 
 void MessageBroadcaster::broadcastSonarData(const data::SonarDataPoint& data,
-                                                    const SessionContainer& sessions) {
+                                            bool changed,
+                                            const SessionContainer& sessions) {
     if (!running_.load()) {
         return; // Not running
     }
 
     try {
-        // Serialize sonar data to JSON (SSOT for sonar serialization)
-        const std::string message = utils::JsonSerializer::serialize(data);
+        // Serialize sonar data once per protocol in use (SSOT for sonar serialization)
+        const ProtocolUsage usage = protocolUsage(sessions, wantsSonarPoint(data, changed));
+        if (!usage.json && !usage.binary) {
+            return; // Every client takes batches, filters this point out or already has it
+        }
+        const MessageTag tag = MessageTag::sonarPoint(data.angle, data.sequence);
+        const SharedMessage json_message = usage.json
+            ? makeSharedMessage(utils::JsonSerializer::serialize(data), FrameType::TEXT, tag) : nullptr;
+        const SharedMessage binary_message = usage.binary
+            ? makeSharedMessage(utils::BinarySerializer::serialize(data), FrameType::BINARY, tag) : nullptr;
 
-        // Broadcast to all sessions
-        broadcastMessage(message, sessions);
+        // Serialized once, shared by all per-point sessions
+        deliverMessage(json_message, binary_message, sessions, SubscriptionTopic::SONAR,
+                       wantsSonarPoint(data, changed));
 
     } catch (const std::exception& e) {
         utils::ErrorHandler::handleException(COMPONENT_NAME, "sonar data broadcast", e,
@@ -122,6 +260,63 @@ void MessageBroadcaster::broadcastSonarData(const data::SonarDataPoint& data,
     }
 }
 
+void MessageBroadcaster::broadcastSonarBatch(const data::SonarBatch& batch,
+                                             const data::SonarBatch& delta_batch,
+                                             const SessionContainer& sessions) {
+    if (!running_.load() || batch.points.empty()) {
+        return;
+    }
+
+    try {
+        // Serialized once per encoding, shared by all per-batch sessions without spatial filters
+        deliverBatch(batch, sessions, wantsSharedBatch(SonarEncoding::FULL));
+        deliverBatch(delta_batch, sessions, wantsSharedBatch(SonarEncoding::DELTA));
+
+        // Sessions with sectors or a range gate get their own reduced batch
+        const uint64_t now_us = steadyNowUs();
+        for (const auto& session : sessions) {
+            if (session && session->isAlive()) {
+                const SubscriptionSnapshot subscription = session->getSubscription();
+                if (wantsFilteredBatch(*session, *subscription)) {
+                    sendFilteredBatch(session, *subscription,
+                                      session->getSonarEncoding() == SonarEncoding::DELTA ? delta_batch : batch,
+                                      now_us);
+                }
+            }
+        }
+
+    } catch (const std::exception& e) {
+        utils::ErrorHandler::handleException(COMPONENT_NAME, "sonar batch broadcast", e,
+                                           data::ErrorSeverity::ERROR);
+        updateBroadcastStats(false);
+    }
+}
+
+void MessageBroadcaster::broadcastEnvironmentData(const data::EnvironmentalData& environment,
+                                                  const SessionContainer& sessions) {
+    if (!running_.load()) {
+        return; // Not running
+    }
+
+    try {
+        // Serialize environmental sample once per protocol in use (SSOT for environment serialization)
+        const ProtocolUsage usage = protocolUsage(sessions, subscribedTo(SubscriptionTopic::ENVIRONMENT));
+        const SharedMessage json_message = usage.json
+            ? makeSharedMessage(utils::JsonSerializer::serialize(environment)) : nullptr;
+        const SharedMessage binary_message = usage.binary
+            ? makeSharedMessage(utils::BinarySerializer::serialize(environment), FrameType::BINARY) : nullptr;
+
+        // Serialized once, shared by all environment subscribers
+        deliverMessage(json_message, binary_message, sessions, SubscriptionTopic::ENVIRONMENT,
+                       subscribedTo(SubscriptionTopic::ENVIRONMENT));
+
+    } catch (const std::exception& e) {
+        utils::ErrorHandler::handleException(COMPONENT_NAME, "environment data broadcast", e,
+                                           data::ErrorSeverity::ERROR);
+        updateBroadcastStats(false);
+    }
+}
+
 void MessageBroadcaster::broadcastPerformanceMetrics(const data::PerformanceMetrics& metrics,
                                                              const SessionContainer& sessions) {
     if (!running_.load()) {
@@ -130,10 +325,11 @@ void MessageBroadcaster::broadcastPerformanceMetrics(const data::PerformanceMetr
 
     try {
         // Serialize performance metrics to JSON (SSOT for metrics serialization)
-        const std::string message = utils::JsonSerializer::serialize(metrics);
+        const SharedMessage message = makeSharedMessage(utils::JsonSerializer::serialize(metrics));
 
-        // Broadcast to all sessions
-        broadcastMessage(message, sessions);
+        // Serialized once, shared by all metrics subscribers
+        deliverMessage(message, message, sessions, SubscriptionTopic::METRICS,
+                       subscribedTo(SubscriptionTopic::METRICS));
 
     } catch (const std::exception& e) {
         utils::ErrorHandler::handleException(COMPONENT_NAME, "performance metrics broadcast", e,
@@ -148,27 +344,58 @@ void MessageBroadcaster::broadcastMessage(const std::string& message,
         return;
     }
 
-    size_t sessions_reached = 0;
-    size_t total_sessions = sessions.size();
+    broadcastMessage(makeSharedMessage(std::string(message)), sessions);
+}
 
-    // Broadcast to each active session
-    for (const auto& session : sessions) {
-        if (session && session->isAlive()) {
-            if (sendToSession(session, message)) {
-                ++sessions_reached;
-            }
+void MessageBroadcaster::broadcastMessage(const SharedMessage& message,
+                                          const SessionContainer& sessions) {
+    if (!message || message->payload.empty()) {
+        return;
+    }
+
+    // Text messages without a binary layout go to every client as-is
+    broadcastMessage(message, message, sessions);
+}
+
+void MessageBroadcaster::broadcastMessage(const SharedMessage& json_message,
+                                          const SharedMessage& binary_message,
+                                          const SessionContainer& sessions) {
+    // Status and other text broadcasts
+    deliverMessage(json_message, binary_message, sessions, SubscriptionTopic::STATUS,
+                   subscribedTo(SubscriptionTopic::STATUS));
+}
+
+bool MessageBroadcaster::sendFilteredBatch(const std::shared_ptr<WebSocketSession>& session,
+                                           const SubscriptionFilter& subscription,
+                                           const data::SonarBatch& batch,
+                                           uint64_t now_us) {
+    data::SonarBatch filtered;
+    filtered.sweep_count = batch.sweep_count;
+    filtered.sweep_complete = batch.sweep_complete;
+    filtered.points.reserve(batch.points.size());
+    for (const auto& point : batch.points) {
+        if (subscription.acceptsPoint(point.angle, point.distance)) {
+            filtered.points.push_back(point);
         }
     }
 
-    // Update statistics and notify completion
-    const bool success = (sessions_reached > 0 || total_sessions == 0);
-    updateBroadcastStats(success);
-    notifyBroadcastComplete(sessions_reached);
+    if (filtered.points.empty() || !session->admitMessage(subscription, SubscriptionTopic::SONAR, now_us)) {
+        return false;
+    }
 
-    // Log broadcast results for debugging
-    if (total_sessions > 0) {
-        std::cout << "[" << COMPONENT_NAME << "] Broadcast to " << sessions_reached
-                  << "/" << total_sessions << " sessions" << std::endl;
+    try {
+        // Serialized for this session only, in its negotiated format
+        const MessageTag tag = MessageTag::sonarBatch(filtered.sweep_count, filtered.points.back().sequence);
+        const SharedMessage message = session->usesBinaryProtocol()
+            ? makeSharedMessage(utils::BinarySerializer::serialize(filtered), FrameType::BINARY, tag)
+            : makeSharedMessage(utils::JsonSerializer::serialize(filtered), FrameType::TEXT, tag);
+        return sendToSession(session, message);
+
+    } catch (const std::exception& e) {
+        utils::ErrorHandler::handleException(COMPONENT_NAME,
+                                           "filtered batch for " + session->getClientEndpoint(),
+                                           e, data::ErrorSeverity::WARNING);
+        return false;
     }
 }
 
@@ -184,8 +411,8 @@ uint64_t MessageBroadcaster::getFailedBroadcasts() const noexcept {
     return failed_broadcasts_.load();
 }
 
-bool MessageBroadcaster::sendToSession(std::shared_ptr<WebSocketSession> session,
-                                               const std::string& message) {
+bool MessageBroadcaster::sendToSession(const std::shared_ptr<WebSocketSession>& session,
+                                       const SharedMessage& message) {
     if (!session || !session->isAlive()) {
         return false;
     }
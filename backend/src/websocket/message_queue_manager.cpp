@@ -9,64 +9,172 @@
 
 #include "websocket/message_queue_manager.hpp"
 #include "utils/error_handler.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
+#include <algorithm>
 
 namespace siren::websocket {
 
 // SSOT for queue manager constants (MISRA C++ Rule 5.0.1)
 namespace {
     constexpr const char* COMPONENT_NAME = "MessageQueueManager";
-    constexpr size_t MAX_MESSAGE_QUEUE_SIZE = 100;  // Maximum queued messages (hard limit)
-    constexpr size_t MESSAGE_QUEUE_WARNING_SIZE = 80;  // Warning threshold (80% of max)
+    constexpr uint32_t DECIMATION_STEP = 2;  // Factor multiplier per sweep boundary
+
+    namespace bp = siren::constants::communication::backpressure;
 }
 
 MessageQueueManager::MessageQueueManager(const std::string& client_endpoint,
                                         QueueFullCallback queue_full_callback)
     : queue_mutex_()
     , message_queue_()
+    , front_sequence_(0)
+    , policy_(BackpressurePolicy::DROP_OLDEST)
+    , statistics_()
+    , above_warning_(false)
+    , angle_slots_()
+    , sweep_tracker_()
+    , current_sweep_(0)
     , client_endpoint_(client_endpoint)
     , queue_full_callback_(std::move(queue_full_callback))
 {
-    std::cout << "[" << COMPONENT_NAME << "] Initializing queue manager for " << client_endpoint_ << std::endl;
+    angle_slots_.fill(0);
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing queue manager for " << client_endpoint_);
+}
+
+void MessageQueueManager::setPolicy(BackpressurePolicy policy) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    policy_ = policy;
+}
+
+BackpressurePolicy MessageQueueManager::getPolicy() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return policy_;
 }
 
-bool MessageQueueManager::enqueueMessage(const std::string& message,
+bool MessageQueueManager::enqueueMessage(SharedMessage message,
                                         const std::atomic<bool>& /* write_in_progress */) {
-    if (message.empty()) {
+    if (!message || message->payload.empty()) {
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(queue_mutex_);
+    std::unique_lock<std::mutex> lock(queue_mutex_);
 
-    // Check queue size for backpressure management
-    const size_t current_queue_size = message_queue_.size();
-    
-    if (current_queue_size >= MAX_MESSAGE_QUEUE_SIZE) {
-        // CRITICAL: Hard limit reached - trigger client disconnection
-        utils::ErrorHandler::handleSystemError(COMPONENT_NAME,
-            "Message queue full for client " + client_endpoint_ + " - triggering disconnect",
-            data::ErrorSeverity::ERROR);
-        
-        // Trigger client disconnection through callback
-        if (queue_full_callback_) {
-            queue_full_callback_();
+    if (policy_ == BackpressurePolicy::DECIMATE_SWEEPS && decimate(message->tag)) {
+        ++statistics_.messages_decimated;
+        return true;
+    }
+
+    if (policy_ == BackpressurePolicy::CONFLATE_PER_ANGLE && conflate(message)) {
+        ++statistics_.messages_conflated;
+        return true;
+    }
+
+    // Byte budget: make room, or give up on the client under the disconnect policy
+    const size_t message_bytes = message->payload.size();
+    while (!message_queue_.empty() && (statistics_.bytes_queued + message_bytes > bp::MAX_QUEUED_BYTES)) {
+        if (policy_ == BackpressurePolicy::DISCONNECT) {
+            // CRITICAL: Hard limit reached - trigger client disconnection
+            utils::ErrorHandler::handleSystemError(COMPONENT_NAME,
+                "Message queue full for client " + client_endpoint_ + " - triggering disconnect",
+                data::ErrorSeverity::ERROR);
+
+            // Trigger client disconnection through callback (may re-enter the queue)
+            lock.unlock();
+            if (queue_full_callback_) {
+                queue_full_callback_();
+            }
+            return false;
         }
-        return false;
-        
-    } else if (current_queue_size >= MESSAGE_QUEUE_WARNING_SIZE) {
-        // WARNING: Approaching limit - log warning for monitoring
+
+        popFront();
+        ++statistics_.messages_dropped;
+    }
+
+    // Normal operation - enqueue message
+    if (message->tag.kind == MessageKind::SONAR_POINT) {
+        const size_t bin = angleBin(message->tag.angle);
+        if (bin < bp::ANGLE_BIN_COUNT) {
+            angle_slots_[bin] = front_sequence_ + message_queue_.size() + 1;
+        }
+    }
+    statistics_.bytes_queued += message_bytes;
+    statistics_.peak_bytes_queued = std::max(statistics_.peak_bytes_queued, statistics_.bytes_queued);
+    message_queue_.push_back(std::move(message));
+
+    // WARNING: Approaching limit - log once per excursion for monitoring
+    const bool above_warning = statistics_.bytes_queued >= bp::WARNING_QUEUED_BYTES;
+    if (above_warning && !above_warning_) {
         utils::ErrorHandler::handleSystemError(COMPONENT_NAME,
-            "Message queue approaching limit for client " + client_endpoint_ + 
-            " (" + std::to_string(current_queue_size) + "/" + std::to_string(MAX_MESSAGE_QUEUE_SIZE) + ")",
+            "Message queue approaching limit for client " + client_endpoint_ +
+            " (" + std::to_string(statistics_.bytes_queued) + "/" + std::to_string(bp::MAX_QUEUED_BYTES) + " bytes)",
             data::ErrorSeverity::WARNING);
     }
+    above_warning_ = above_warning;
+    return true;
+}
+
+bool MessageQueueManager::conflate(const SharedMessage& message) {
+    if (message->tag.kind != MessageKind::SONAR_POINT) {
+        return false;
+    }
 
-    // Normal operation - enqueue message
-    message_queue_.push(message);
+    const size_t bin = angleBin(message->tag.angle);
+    if (bin >= bp::ANGLE_BIN_COUNT) {
+        return false;
+    }
+
+    // Slot is stale once its message has been written or dropped
+    const uint64_t slot = angle_slots_[bin];
+    if (slot == 0 || (slot - 1) < front_sequence_) {
+        return false;
+    }
+
+    SharedMessage& queued = message_queue_[static_cast<size_t>(slot - 1 - front_sequence_)];
+    statistics_.bytes_queued = statistics_.bytes_queued - queued->payload.size() + message->payload.size();
+    statistics_.peak_bytes_queued = std::max(statistics_.peak_bytes_queued, statistics_.bytes_queued);
+    queued = message;
     return true;
 }
 
-bool MessageQueueManager::getNextMessage(std::string& message) {
+bool MessageQueueManager::decimate(const MessageTag& tag) {
+    uint32_t sweep = 0;
+    if (tag.kind == MessageKind::SONAR_BATCH) {
+        sweep = tag.sweep;
+    } else if (tag.kind == MessageKind::SONAR_POINT) {
+        sweep_tracker_.update(tag.angle);
+        sweep = sweep_tracker_.getState().sweep_count;
+    } else {
+        return false; // Only sonar data is decimated
+    }
+
+    // Adapt the factor once per sweep from the queue depth
+    if (sweep != current_sweep_) {
+        current_sweep_ = sweep;
+        const uint32_t factor = statistics_.decimation_factor;
+        if (statistics_.bytes_queued > bp::DECIMATION_HIGH_WATER_BYTES && factor < bp::MAX_DECIMATION_FACTOR) {
+            statistics_.decimation_factor = factor * DECIMATION_STEP;
+        } else if (statistics_.bytes_queued < bp::DECIMATION_LOW_WATER_BYTES && factor > 1) {
+            statistics_.decimation_factor = factor / DECIMATION_STEP;
+        }
+        if (statistics_.decimation_factor != factor) {
+            SIREN_LOG_INFO(COMPONENT_NAME, "Sending every " << statistics_.decimation_factor
+                                           << " sweep(s) to " << client_endpoint_);
+        }
+    }
+
+    return (sweep % statistics_.decimation_factor) != 0;
+}
+
+void MessageQueueManager::popFront() {
+    statistics_.bytes_queued -= message_queue_.front()->payload.size();
+    message_queue_.pop_front();
+    ++front_sequence_;
+}
+
+size_t MessageQueueManager::angleBin(int16_t angle) noexcept {
+    return (angle < 0) ? bp::ANGLE_BIN_COUNT : std::min(static_cast<size_t>(angle), bp::ANGLE_BIN_COUNT);
+}
+
+bool MessageQueueManager::getNextMessage(SharedMessage& message) {
     std::lock_guard<std::mutex> lock(queue_mutex_);
     
     if (message_queue_.empty()) {
@@ -74,7 +182,7 @@ bool MessageQueueManager::getNextMessage(std::string& message) {
     }
 
     message = message_queue_.front();
-    message_queue_.pop();
+    popFront();
     return true;
 }
 
@@ -88,14 +196,21 @@ size_t MessageQueueManager::size() const {
     return message_queue_.size();
 }
 
+data::QueueStatistics MessageQueueManager::getStatistics() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return statistics_;
+}
+
 void MessageQueueManager::clear() {
     std::lock_guard<std::mutex> lock(queue_mutex_);
     
-    // Clear queue by swapping with empty queue (efficient)
-    std::queue<std::string> empty_queue;
-    message_queue_.swap(empty_queue);
+    // Advancing the front sequence invalidates every conflation slot
+    front_sequence_ += message_queue_.size();
+    message_queue_.clear();
+    statistics_.bytes_queued = 0;
+    above_warning_ = false;
     
-    std::cout << "[" << COMPONENT_NAME << "] Cleared message queue for " << client_endpoint_ << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Cleared message queue for " << client_endpoint_);
 }
 
 } // namespace siren::websocket
\ No newline at end of file
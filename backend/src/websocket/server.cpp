@@ -14,7 +14,8 @@
 #include "utils/json_serializer.hpp"
 #include "constants/message.hpp"
 #include "utils/error_handler.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
+#include <algorithm>
 #include <chrono>
 
 namespace siren::websocket {
@@ -22,6 +23,11 @@ namespace siren::websocket {
 namespace http = beast::http;  // Local alias for HTTP functionality
 namespace cnst = siren::constants;  // Local alias for constants
 
+// SSOT for log component name (MISRA C++ Rule 5.0.1)
+namespace {
+    constexpr const char* COMPONENT_NAME = "WebSocketServer";
+}
+
 
 // WebSocketServer Implementation
 
@@ -31,8 +37,7 @@ WebSocketServer::WebSocketServer(boost::asio::io_context& io_context, uint16_t p
     , running_(false)
     , shutdown_requested_(false)
 {
-    std::cout << cnst::message::websocket_status::SERVER_PREFIX << " "
-              << cnst::message::websocket_status::INITIALIZING_SERVER << " " << port << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, cnst::message::websocket_status::INITIALIZING_SERVER << " " << port);
 
 
     // Create specialized managers - SRP compliant components
@@ -74,6 +79,18 @@ void WebSocketServer::broadcastSonarData(const data::SonarDataPoint& data) {
     broadcast_coordinator_->broadcastSonarData(data, running_);
 }
 
+void WebSocketServer::broadcastSonarBatch(const data::SonarBatch& batch) {
+    broadcast_coordinator_->broadcastSonarBatch(batch, running_);
+}
+
+void WebSocketServer::configureDeltaEncoding(int16_t threshold_cm, uint64_t keyframe_interval_us) {
+    broadcast_coordinator_->configureDeltaEncoding(threshold_cm, keyframe_interval_us);
+}
+
+void WebSocketServer::broadcastEnvironmentData(const data::EnvironmentalData& environment) {
+    broadcast_coordinator_->broadcastEnvironmentData(environment, running_);
+}
+
 void WebSocketServer::broadcastPerformanceMetrics(const data::PerformanceMetrics& metrics) {
     broadcast_coordinator_->broadcastPerformanceMetrics(metrics, running_);
 }
@@ -82,6 +99,48 @@ size_t WebSocketServer::getActiveConnections() const noexcept {
     return session_manager_ ? session_manager_->getActiveSessionCount() : 0;
 }
 
+data::QueueStatistics WebSocketServer::getQueueStatistics() const {
+    if (!session_manager_) {
+        return data::QueueStatistics();
+    }
+
+    // Counters of disconnected clients stay in the totals; bytes are live only
+    data::QueueStatistics total = session_manager_->getRetiredQueueStatistics();
+    const SessionManager::SessionSnapshot sessions = session_manager_->getActiveSessions();
+    for (const auto& session : *sessions) {
+        const data::QueueStatistics statistics = session->getQueueStatistics();
+        total.bytes_queued += statistics.bytes_queued;
+        total.peak_bytes_queued = std::max(total.peak_bytes_queued, statistics.peak_bytes_queued);
+        total.messages_dropped += statistics.messages_dropped;
+        total.messages_conflated += statistics.messages_conflated;
+        total.messages_decimated += statistics.messages_decimated;
+        total.decimation_factor = std::max(total.decimation_factor, statistics.decimation_factor);
+    }
+    return total;
+}
+
+std::vector<data::SessionQueueStatistics> WebSocketServer::getSessionQueueStatistics() const {
+    std::vector<data::SessionQueueStatistics> statistics;
+    if (!session_manager_) {
+        return statistics;
+    }
+
+    const SessionManager::SessionSnapshot sessions = session_manager_->getActiveSessions();
+    statistics.reserve(sessions->size());
+    for (const auto& session : *sessions) {
+        statistics.push_back(session->getSessionQueueStatistics());
+    }
+    return statistics;
+}
+
+data::ScanSnapshot WebSocketServer::getScanSnapshot() const {
+    return broadcast_coordinator_ ? broadcast_coordinator_->getScanSnapshot() : data::ScanSnapshot();
+}
+
+bool WebSocketServer::getReplay(uint32_t last_sequence, data::SonarReplay& replay) const {
+    return broadcast_coordinator_ && broadcast_coordinator_->getReplay(last_sequence, replay);
+}
+
 data::WebSocketStatistics WebSocketServer::getStatistics() const {
     if (statistics_collector_) {
         return statistics_collector_->getStatistics(getActiveConnections());
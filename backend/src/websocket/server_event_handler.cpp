@@ -13,7 +13,7 @@
 #include "websocket/statistics_collector.hpp"
 #include "utils/error_handler.hpp"
 #include "constants/message.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
 
 namespace siren::websocket {
 
@@ -30,7 +30,7 @@ ServerEventHandler::ServerEventHandler(std::shared_ptr<SessionManager> session_m
     , statistics_collector_(statistics_collector)
     , connection_callback_(nullptr)
 {
-    std::cout << "[" << COMPONENT_NAME << "] Initializing server event handler" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing server event handler");
 }
 
 void ServerEventHandler::onConnectionAccepted(tcp::socket socket,
@@ -58,9 +58,8 @@ void ServerEventHandler::onConnectionAccepted(tcp::socket socket,
         session->start();
 
         // Log connection acceptance
-        std::cout << cnst::message::websocket_status::SERVER_PREFIX << " "
-                  << cnst::message::websocket_status::NEW_CLIENT_CONNECTED << ": " << session->getClientEndpoint()
-                  << " " << cnst::message::websocket_status::TOTAL_CLIENTS << " " << getActiveConnections() << ")" << std::endl;
+        SIREN_LOG_INFO("WebSocketServer", cnst::message::websocket_status::NEW_CLIENT_CONNECTED << ": " << session->getClientEndpoint()
+                                          << " " << cnst::message::websocket_status::TOTAL_CLIENTS << " " << getActiveConnections() << ")");
 
         // Update statistics
         if (auto stats_collector = statistics_collector_.lock()) {
@@ -102,8 +101,8 @@ void ServerEventHandler::onSessionEvent(const std::string& endpoint, bool connec
         }
 
         // Log session event for debugging
-        std::cout << "[" << COMPONENT_NAME << "] Session event: " << endpoint
-                  << " " << (connected ? "connected" : "disconnected") << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Session event: " << endpoint
+                                       << " " << (connected ? "connected" : "disconnected"));
 
     } catch (const std::exception& e) {
         utils::ErrorHandler::handleException(COMPONENT_NAME,
@@ -115,8 +114,8 @@ void ServerEventHandler::onSessionEvent(const std::string& endpoint, bool connec
 void ServerEventHandler::onBroadcastCompleted(size_t sessions_reached) {
     try {
         // Log broadcast completion for debugging
-        std::cout << "[" << COMPONENT_NAME << "] Broadcast completed, reached "
-                  << sessions_reached << " sessions" << std::endl;
+        SIREN_LOG_DEBUG(COMPONENT_NAME, "Broadcast completed, reached "
+                                        << sessions_reached << " sessions");
 
         // Future extension point: Additional metrics tracking for broadcasts
         // This method provides a clean extension point for broadcast analytics
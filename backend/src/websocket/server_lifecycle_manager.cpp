@@ -16,7 +16,7 @@
 #include "websocket/server.hpp"
 #include "constants/message.hpp"
 #include "utils/error_handler.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
 
 namespace siren::websocket {
 
@@ -41,7 +41,7 @@ ServerLifecycleManager::ServerLifecycleManager(
     , event_handler_(event_handler)
     , port_(port)
 {
-    std::cout << "[" << COMPONENT_NAME << "] Initializing lifecycle manager for port " << port_ << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing lifecycle manager for port " << port_);
 }
 
 bool ServerLifecycleManager::initialize(std::weak_ptr<WebSocketServer> server_weak_ptr) {
@@ -91,8 +91,7 @@ bool ServerLifecycleManager::initialize(std::weak_ptr<WebSocketServer> server_we
                 event_handler_->onBroadcastCompleted(sessions_reached);
             });
 
-        std::cout << cnst::message::websocket_status::SERVER_PREFIX << " "
-                  << cnst::message::websocket_status::SERVER_INITIALIZED << " " << port_ << std::endl;
+        SIREN_LOG_INFO("WebSocketServer", cnst::message::websocket_status::SERVER_INITIALIZED << " " << port_);
         return true;
 
     } catch (const std::exception& e) {
@@ -148,8 +147,7 @@ bool ServerLifecycleManager::start(std::atomic<bool>& running) {
 
         running.store(true);
 
-        std::cout << cnst::message::websocket_status::SERVER_PREFIX << " "
-                  << cnst::message::websocket_status::SERVER_STARTED << " " << port_ << std::endl;
+        SIREN_LOG_INFO("WebSocketServer", cnst::message::websocket_status::SERVER_STARTED << " " << port_);
 
         return true;
 
@@ -168,8 +166,7 @@ void ServerLifecycleManager::stop(std::atomic<bool>& running, std::atomic<bool>&
         return;
     }
 
-    std::cout << cnst::message::websocket_status::SERVER_PREFIX << " "
-              << cnst::message::websocket_status::STOPPING_SERVER << std::endl;
+    SIREN_LOG_INFO("WebSocketServer", cnst::message::websocket_status::STOPPING_SERVER);
 
     shutdown_requested.store(true);
     running.store(false);
@@ -191,8 +188,7 @@ void ServerLifecycleManager::stop(std::atomic<bool>& running, std::atomic<bool>&
         statistics_collector_->stop();
     }
 
-    std::cout << cnst::message::websocket_status::SERVER_PREFIX << " "
-              << cnst::message::websocket_status::SERVER_STOPPED << std::endl;
+    SIREN_LOG_INFO("WebSocketServer", cnst::message::websocket_status::SERVER_STOPPED);
 }
 
 void ServerLifecycleManager::rollbackStartedComponents(bool connection_acceptor_started,
@@ -202,24 +198,24 @@ void ServerLifecycleManager::rollbackStartedComponents(bool connection_acceptor_
         // Stop components in reverse order of startup (MISRA C++ Rule 21.2.1 - RAII cleanup)
         if (statistics_collector_started && statistics_collector_) {
             statistics_collector_->stop();
-            std::cout << "[" << COMPONENT_NAME << "] Rolled back statistics collector" << std::endl;
+            SIREN_LOG_INFO(COMPONENT_NAME, "Rolled back statistics collector");
         }
 
         if (message_broadcaster_started && message_broadcaster_) {
             message_broadcaster_->stop();
-            std::cout << "[" << COMPONENT_NAME << "] Rolled back message broadcaster" << std::endl;
+            SIREN_LOG_INFO(COMPONENT_NAME, "Rolled back message broadcaster");
         }
 
         if (connection_acceptor_started && connection_acceptor_) {
             connection_acceptor_->stop();
-            std::cout << "[" << COMPONENT_NAME << "] Rolled back connection acceptor" << std::endl;
+            SIREN_LOG_INFO(COMPONENT_NAME, "Rolled back connection acceptor");
         }
 
-        std::cout << "[" << COMPONENT_NAME << "] Component rollback completed successfully" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Component rollback completed successfully");
 
     } catch (...) {
         // noexcept function - cannot throw, log critical error
-        std::cout << "[" << COMPONENT_NAME << "] CRITICAL: Rollback failed - components may be in inconsistent state" << std::endl;
+        SIREN_LOG_CRITICAL(COMPONENT_NAME, "CRITICAL: Rollback failed - components may be in inconsistent state");
     }
 }
 
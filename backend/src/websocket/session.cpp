@@ -11,10 +11,15 @@
 #include "websocket/server.hpp"
 #include "websocket/message_queue_manager.hpp"
 #include "utils/json_serializer.hpp"
+#include "utils/binary_serializer.hpp"
 #include "utils/error_handler.hpp"
 #include "constants/message.hpp"
 #include "constants/communication.hpp"
-#include <iostream>
+#include "constants/error.hpp"
+#include "utils/logger.hpp"
+#include "utils/latency_tracker.hpp"
+#include "utils/replay_ring.hpp"
+#include <charconv>
 #include <chrono>
 
 namespace siren::websocket {
@@ -25,6 +30,87 @@ namespace cnst = siren::constants;
 namespace {
     constexpr const char* COMPONENT_NAME = "WebSocketSession";
     constexpr auto WEBSOCKET_TIMEOUT = std::chrono::seconds(30);  // WebSocket timeout
+    constexpr const char* PROTOCOL_SEPARATORS = ", \t";  // Sec-WebSocket-Protocol list delimiters
+    constexpr char QUERY_START = '?';
+    constexpr char QUERY_SEPARATOR = '&';
+    constexpr char QUERY_ASSIGN = '=';
+
+    /// Check whether a comma-separated Sec-WebSocket-Protocol offer contains a token
+    bool offersSubprotocol(beast::string_view offered, beast::string_view token) {
+        size_t position = 0;
+        while (position < offered.size()) {
+            const size_t begin = offered.find_first_not_of(PROTOCOL_SEPARATORS, position);
+            if (begin == beast::string_view::npos) {
+                break;
+            }
+            size_t end = offered.find_first_of(PROTOCOL_SEPARATORS, begin);
+            if (end == beast::string_view::npos) {
+                end = offered.size();
+            }
+            if (offered.substr(begin, end - begin) == token) {
+                return true;
+            }
+            position = end;
+        }
+        return false;
+    }
+
+    /// Value of a query parameter in a request target ("/path?a=1&b=2"), empty if absent
+    beast::string_view queryParameter(beast::string_view target, beast::string_view name) {
+        const size_t query_start = target.find(QUERY_START);
+        if (query_start == beast::string_view::npos) {
+            return {};
+        }
+
+        beast::string_view query = target.substr(query_start + 1);
+        while (!query.empty()) {
+            const size_t separator = query.find(QUERY_SEPARATOR);
+            const beast::string_view parameter = query.substr(0, separator);
+            const size_t assign = parameter.find(QUERY_ASSIGN);
+            if (assign != beast::string_view::npos && parameter.substr(0, assign) == name) {
+                return parameter.substr(assign + 1);
+            }
+            if (separator == beast::string_view::npos) {
+                break;
+            }
+            query.remove_prefix(separator + 1);
+        }
+        return {};
+    }
+
+    /// Parse a decimal sequence number query parameter value
+    bool parseSequence(beast::string_view value, uint32_t& sequence) {
+        const char* const end = value.data() + value.size();
+        const auto result = std::from_chars(value.data(), end, sequence);
+        return !value.empty() && result.ec == std::errc() && result.ptr == end;
+    }
+
+    /// Backpressure policy for a query parameter value; unknown or absent values keep drop-oldest
+    BackpressurePolicy parseBackpressurePolicy(beast::string_view value) {
+        namespace bp = cnst::communication::backpressure;
+        if (value == bp::POLICY_DISCONNECT) {
+            return BackpressurePolicy::DISCONNECT;
+        }
+        if (value == bp::POLICY_CONFLATE) {
+            return BackpressurePolicy::CONFLATE_PER_ANGLE;
+        }
+        if (value == bp::POLICY_DECIMATE) {
+            return BackpressurePolicy::DECIMATE_SWEEPS;
+        }
+        return BackpressurePolicy::DROP_OLDEST;
+    }
+
+    /// Query parameter value naming a backpressure policy (for logging and metrics)
+    const char* backpressurePolicyName(BackpressurePolicy policy) noexcept {
+        namespace bp = cnst::communication::backpressure;
+        switch (policy) {
+            case BackpressurePolicy::DISCONNECT:         return bp::POLICY_DISCONNECT;
+            case BackpressurePolicy::CONFLATE_PER_ANGLE: return bp::POLICY_CONFLATE;
+            case BackpressurePolicy::DECIMATE_SWEEPS:    return bp::POLICY_DECIMATE;
+            case BackpressurePolicy::DROP_OLDEST:        break;
+        }
+        return bp::POLICY_DROP_OLDEST;
+    }
 }
 
 WebSocketSession::WebSocketSession(tcp::socket&& socket,
@@ -34,8 +120,20 @@ WebSocketSession::WebSocketSession(tcp::socket&& socket,
     , client_endpoint_()
     , is_alive_(false)
     , closing_(false)
+    , binary_protocol_(false)
+    , sonar_delivery_(SonarDelivery::PER_POINT)
+    , sonar_encoding_(SonarEncoding::FULL)
+    , upgrade_request_()
+    , resume_requested_(false)
+    , resume_sequence_(0)
+    , replay_pending_(false)
+    , replay_sequence_(0)
     , queue_manager_(nullptr)
     , write_in_progress_(false)
+    , write_message_()
+    , write_started_()
+    , subscription_(std::make_shared<const SubscriptionFilter>())
+    , last_delivery_us_()
     , buffer_()
 {
     try {
@@ -52,7 +150,7 @@ WebSocketSession::WebSocketSession(tcp::socket&& socket,
                 close();
             });
 
-        std::cout << "[" << COMPONENT_NAME << "] Session created for " << client_endpoint_ << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Session created for " << client_endpoint_);
 
     } catch (const std::exception& e) {
         utils::ErrorHandler::handleException(COMPONENT_NAME, "constructor", e,
@@ -62,26 +160,29 @@ WebSocketSession::WebSocketSession(tcp::socket&& socket,
 }
 
 void WebSocketSession::start() {
+    // Socket was accepted on this session's strand; run all stream operations there
+    boost::asio::dispatch(ws_.get_executor(),
+        [self = shared_from_this()]() {
+            self->onStart();
+        });
+}
+
+void WebSocketSession::onStart() {
     try {
         // Set WebSocket options
         ws_.set_option(websocket::stream_base::timeout::suggested(
             beast::role_type::server));
 
-        // Set decorator for HTTP response
-        ws_.set_option(websocket::stream_base::decorator(
-            [](websocket::response_type& res) {
-                res.set(beast::http::field::server,
-                       std::string("SIREN-Military-Server"));
-            }));
-
-        // Start WebSocket handshake
-        ws_.async_accept(
-            [self = shared_from_this()](beast::error_code ec) {
-                self->onAccept(ec);
+        // Read the upgrade request ourselves to see which subprotocols are offered
+        beast::get_lowest_layer(ws_).expires_after(WEBSOCKET_TIMEOUT);
+        beast::http::async_read(ws_.next_layer(), buffer_, upgrade_request_,
+            [self = shared_from_this()](beast::error_code ec, std::size_t /* bytes_transferred */) {
+                utils::ScopedHandlerTimer timer;
+                self->onUpgradeRequest(ec);
             });
 
-        std::cout << "[" << COMPONENT_NAME << "] Starting WebSocket handshake for "
-                  << client_endpoint_ << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Starting WebSocket handshake for "
+                                       << client_endpoint_);
 
     } catch (const std::exception& e) {
         handleError("Failed to start session", beast::error_code{});
@@ -94,9 +195,14 @@ void WebSocketSession::sendSonarData(const data::SonarDataPoint& data) {
     }
 
     try {
-        // Serialize sonar data to JSON (SSOT for sonar serialization)
-        std::string message = utils::JsonSerializer::serialize(data);
-        enqueueMessage(message);
+        // Serialize sonar data in the negotiated format (SSOT for sonar serialization)
+        if (usesBinaryProtocol()) {
+            postMessage(makeSharedMessage(utils::BinarySerializer::serialize(data), FrameType::BINARY,
+                                          MessageTag::sonarPoint(data.angle, data.sequence)));
+        } else {
+            postMessage(makeSharedMessage(utils::JsonSerializer::serialize(data), FrameType::TEXT,
+                                          MessageTag::sonarPoint(data.angle, data.sequence)));
+        }
 
     } catch (const std::exception& e) {
         utils::ErrorHandler::handleException(COMPONENT_NAME,
@@ -112,8 +218,7 @@ void WebSocketSession::sendPerformanceMetrics(const data::PerformanceMetrics& me
 
     try {
         // Serialize performance metrics to JSON (SSOT for metrics serialization)
-        std::string message = utils::JsonSerializer::serialize(metrics);
-        enqueueMessage(message);
+        postMessage(makeSharedMessage(utils::JsonSerializer::serialize(metrics)));
 
     } catch (const std::exception& e) {
         utils::ErrorHandler::handleException(COMPONENT_NAME,
@@ -127,7 +232,15 @@ void WebSocketSession::sendMessage(const std::string& message) {
         return;
     }
 
-    enqueueMessage(message);
+    postMessage(makeSharedMessage(std::string(message)));
+}
+
+void WebSocketSession::sendMessage(SharedMessage message) {
+    if (!isAlive() || !message || message->payload.empty()) {
+        return;
+    }
+
+    postMessage(std::move(message));
 }
 
 void WebSocketSession::close() {
@@ -135,16 +248,34 @@ void WebSocketSession::close() {
         return; // Already closing
     }
 
-    std::cout << "[" << COMPONENT_NAME << "] Closing session for " << client_endpoint_ << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Closing session for " << client_endpoint_);
 
+    const data::QueueStatistics statistics = getQueueStatistics();
+    if (statistics.messages_dropped + statistics.messages_conflated + statistics.messages_decimated > 0) {
+        SIREN_LOG_INFO(COMPONENT_NAME, "Backpressure for " << client_endpoint_ << ": "
+                                       << statistics.messages_dropped << " dropped, "
+                                       << statistics.messages_conflated << " conflated, "
+                                       << statistics.messages_decimated << " decimated, peak "
+                                       << statistics.peak_bytes_queued << " bytes queued");
+    }
+
+    // May be called from any thread; the stream is only touched on its strand
+    boost::asio::dispatch(ws_.get_executor(),
+        [self = shared_from_this()]() {
+            self->onClose();
+        });
+}
+
+void WebSocketSession::onClose() {
     try {
         if (ws_.is_open()) {
             ws_.async_close(websocket::close_code::normal,
                 [self = shared_from_this()](beast::error_code ec) {
+                    utils::ScopedHandlerTimer timer;
                     if (ec) {
                         // Log close error but don't throw
-                        std::cout << "[WebSocketSession] Close error for "
-                                  << self->client_endpoint_ << ": " << ec.message() << std::endl;
+                        SIREN_LOG_WARNING(COMPONENT_NAME, "Close error for "
+                                                          << self->client_endpoint_ << ": " << ec.message());
                     }
                     self->is_alive_.store(false);
                 });
@@ -173,19 +304,233 @@ std::string WebSocketSession::getClientEndpoint() const {
     return client_endpoint_;
 }
 
+bool WebSocketSession::usesBinaryProtocol() const noexcept {
+    return binary_protocol_.load();
+}
+
+SonarDelivery WebSocketSession::getSonarDelivery() const noexcept {
+    return sonar_delivery_.load();
+}
+
+SonarEncoding WebSocketSession::getSonarEncoding() const noexcept {
+    return sonar_encoding_.load();
+}
+
+SubscriptionSnapshot WebSocketSession::getSubscription() const {
+    return std::atomic_load(&subscription_);
+}
+
+bool WebSocketSession::admitMessage(const SubscriptionFilter& subscription,
+                                    SubscriptionTopic topic, uint64_t now_us) {
+    const uint32_t min_interval_us = subscription.getMinIntervalUs();
+    if (min_interval_us == 0) {
+        return true;
+    }
+
+    // One producer per topic in practice; the CAS keeps concurrent producers from both passing
+    std::atomic<uint64_t>& last_delivery = last_delivery_us_[static_cast<size_t>(topic)];
+    uint64_t last = last_delivery.load(std::memory_order_relaxed);
+    while (now_us >= last + min_interval_us) {
+        if (last_delivery.compare_exchange_weak(last, now_us, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void WebSocketSession::sendScanSnapshot() {
+    const auto server = server_weak_ptr_.lock();
+    if (!server) {
+        return;
+    }
+
+    try {
+        const data::ScanSnapshot snapshot = server->getScanSnapshot();
+        if (snapshot.points.empty()) {
+            return; // Nothing scanned yet
+        }
+
+        // Enqueued directly on the strand: live data posted since is_alive_ was set queues after it
+        if (usesBinaryProtocol()) {
+            enqueueMessage(makeSharedMessage(utils::BinarySerializer::serialize(snapshot), FrameType::BINARY));
+        } else {
+            enqueueMessage(makeSharedMessage(utils::JsonSerializer::serialize(snapshot)));
+        }
+
+        SIREN_LOG_DEBUG(COMPONENT_NAME, "Sent " << snapshot.points.size() << "-point scan snapshot to "
+                                        << client_endpoint_);
+
+    } catch (const std::exception& e) {
+        utils::ErrorHandler::handleException(COMPONENT_NAME,
+                                           "scan snapshot for " + client_endpoint_,
+                                           e, data::ErrorSeverity::WARNING);
+    }
+}
+
+bool WebSocketSession::sendReplay(uint32_t last_sequence) {
+    const auto server = server_weak_ptr_.lock();
+    if (!server) {
+        return false;
+    }
+
+    try {
+        data::SonarReplay replay;
+        if (!server->getReplay(last_sequence, replay)) {
+            SIREN_LOG_INFO(COMPONENT_NAME, "Resume from seq " << last_sequence << " for " << client_endpoint_
+                                           << " no longer held, re-syncing with scan snapshot");
+            return false;
+        }
+
+        // One write for the whole gap, enqueued on the strand ahead of live data.
+        // Samples pushed between is_alive_ and collect() are also queued live
+        if (!replay.points.empty()) {
+            replay_pending_ = true;
+            replay_sequence_ = replay.points.back().sequence;
+            if (usesBinaryProtocol()) {
+                enqueueMessage(makeSharedMessage(utils::BinarySerializer::serialize(replay), FrameType::BINARY));
+            } else {
+                enqueueMessage(makeSharedMessage(utils::JsonSerializer::serialize(replay)));
+            }
+        }
+
+        SIREN_LOG_INFO(COMPONENT_NAME, "Resumed " << client_endpoint_ << " from seq " << last_sequence
+                                       << ", replayed " << replay.points.size() << " samples");
+        return true;
+
+    } catch (const std::exception& e) {
+        utils::ErrorHandler::handleException(COMPONENT_NAME,
+                                           "replay for " + client_endpoint_,
+                                           e, data::ErrorSeverity::WARNING);
+        return false;
+    }
+}
+
+void WebSocketSession::handleControlMessage(const std::string& message) {
+    SubscriptionFilter filter;
+    std::string error;
+
+    switch (SubscriptionFilter::parse(message, filter, error)) {
+        case SubscriptionParseResult::SUBSCRIPTION:
+            SIREN_LOG_INFO(COMPONENT_NAME, "Subscription for " << client_endpoint_ << ": " << filter.describe());
+            std::atomic_store(&subscription_, SubscriptionSnapshot(
+                std::make_shared<const SubscriptionFilter>(filter)));
+            postMessage(makeSharedMessage(utils::JsonSerializer::createStatusUpdate(
+                cnst::communication::subscription::STATUS_SUBSCRIBED)));
+            break;
+
+        case SubscriptionParseResult::INVALID:
+            SIREN_LOG_WARNING(COMPONENT_NAME, "Rejected subscription from " << client_endpoint_ << ": " << error);
+            postMessage(makeSharedMessage(utils::JsonSerializer::serialize(data::SystemError(
+                data::ErrorSeverity::WARNING, cnst::error::codes::INVALID_SUBSCRIPTION,
+                "Invalid subscription: " + error, COMPONENT_NAME))));
+            break;
+
+        case SubscriptionParseResult::NOT_SUBSCRIPTION:
+            break; // Other control messages are ignored
+    }
+}
+
+data::QueueStatistics WebSocketSession::getQueueStatistics() const {
+    return queue_manager_ ? queue_manager_->getStatistics() : data::QueueStatistics();
+}
+
+data::SessionQueueStatistics WebSocketSession::getSessionQueueStatistics() const {
+    data::SessionQueueStatistics statistics;
+    statistics.endpoint = client_endpoint_;
+    statistics.policy = queue_manager_ ? backpressurePolicyName(queue_manager_->getPolicy())
+                                       : cnst::communication::backpressure::POLICY_DROP_OLDEST;
+    statistics.queues = getQueueStatistics();
+    return statistics;
+}
+
+void WebSocketSession::onUpgradeRequest(beast::error_code ec) {
+    if (ec) {
+        handleError("WebSocket upgrade request read failed", ec);
+        return;
+    }
+
+    // Binary frames only when explicitly offered; everyone else keeps JSON
+    const bool binary = offersSubprotocol(
+        upgrade_request_[beast::http::field::sec_websocket_protocol],
+        cnst::message::binary_protocol::SUBPROTOCOL);
+    binary_protocol_.store(binary);
+
+    // Per-batch sonar delivery only when asked for; unknown values keep per-point
+    const bool batched = queryParameter(upgrade_request_.target(),
+        cnst::communication::batching::DELIVERY_PARAMETER) == cnst::communication::batching::DELIVERY_BATCH;
+    sonar_delivery_.store(batched ? SonarDelivery::PER_BATCH : SonarDelivery::PER_POINT);
+
+    // Delta encoding only when asked for; the connect snapshot is its baseline
+    const bool delta = queryParameter(upgrade_request_.target(),
+        cnst::communication::delta::ENCODING_PARAMETER) == cnst::communication::delta::ENCODING_DELTA;
+    sonar_encoding_.store(delta ? SonarEncoding::DELTA : SonarEncoding::FULL);
+
+    // Reconnecting clients name the last sample they received; malformed values re-sync in full
+    resume_requested_ = parseSequence(queryParameter(upgrade_request_.target(),
+        cnst::communication::resume::LAST_SEQ_PARAMETER), resume_sequence_);
+
+    // Slow-reader handling is chosen per client before any data is queued
+    if (queue_manager_) {
+        queue_manager_->setPolicy(parseBackpressurePolicy(queryParameter(upgrade_request_.target(),
+            cnst::communication::backpressure::POLICY_PARAMETER)));
+    }
+
+    // Set decorator for HTTP response
+    ws_.set_option(websocket::stream_base::decorator(
+        [binary](websocket::response_type& res) {
+            res.set(beast::http::field::server,
+                   std::string("SIREN-Military-Server"));
+            if (binary) {
+                res.set(beast::http::field::sec_websocket_protocol,
+                       cnst::message::binary_protocol::SUBPROTOCOL);
+            }
+        }));
+
+    // The websocket stream applies its own handshake timeout from here on
+    beast::get_lowest_layer(ws_).expires_never();
+
+    // Complete WebSocket handshake with the request already read
+    // (non-upgrade requests are answered with 400 and fail in onAccept)
+    ws_.async_accept(upgrade_request_,
+        [self = shared_from_this()](beast::error_code ec) {
+            utils::ScopedHandlerTimer timer;
+            self->onAccept(ec);
+        });
+}
+
 void WebSocketSession::onAccept(beast::error_code ec) {
     if (ec) {
         handleError("WebSocket handshake failed", ec);
         return;
     }
 
+    // Upgrade request is no longer needed; the buffer is reused for reads
+    upgrade_request_ = {};
+    buffer_.clear();
+
     is_alive_.store(true);
-    std::cout << "[" << COMPONENT_NAME << "] WebSocket handshake completed for "
-              << client_endpoint_ << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "WebSocket handshake completed for "
+                                   << client_endpoint_ << " ("
+                                   << (usesBinaryProtocol() ? cnst::message::binary_protocol::SUBPROTOCOL : "json") << ", "
+                                   << (getSonarDelivery() == SonarDelivery::PER_BATCH
+                                       ? cnst::communication::batching::DELIVERY_BATCH
+                                       : cnst::communication::batching::DELIVERY_POINT) << ", "
+                                   << (getSonarEncoding() == SonarEncoding::DELTA
+                                       ? cnst::communication::delta::ENCODING_DELTA
+                                       : cnst::communication::delta::ENCODING_FULL) << ", "
+                                   << (queue_manager_ ? backpressurePolicyName(queue_manager_->getPolicy())
+                                                      : cnst::communication::backpressure::POLICY_DROP_OLDEST)
+                                   << ")");
+
+    // Resuming clients get what they missed; everyone else (or a gap too old) the full picture
+    if (!resume_requested_ || !sendReplay(resume_sequence_)) {
+        sendScanSnapshot();
+    }
 
     // Start reading for incoming messages
     ws_.async_read(buffer_,
         [self = shared_from_this()](beast::error_code ec, std::size_t bytes_transferred) {
+            utils::ScopedHandlerTimer timer;
             self->onRead(ec, bytes_transferred);
         });
 }
@@ -196,10 +541,13 @@ void WebSocketSession::onRead(beast::error_code ec, std::size_t bytes_transferre
         return;
     }
 
-    // For now, we just acknowledge the message and continue reading
-    // In a full implementation, we would process control messages here
-    std::cout << "[" << COMPONENT_NAME << "] Received " << bytes_transferred
-              << " bytes from " << client_endpoint_ << std::endl;
+    SIREN_LOG_DEBUG(COMPONENT_NAME, "Received " << bytes_transferred
+                                    << " bytes from " << client_endpoint_);
+
+    // Text frames carry control messages; binary frames are not expected from clients
+    if (ws_.got_text()) {
+        handleControlMessage(beast::buffers_to_string(buffer_.data()));
+    }
 
     // Clear buffer for next read
     buffer_.clear();
@@ -208,6 +556,7 @@ void WebSocketSession::onRead(beast::error_code ec, std::size_t bytes_transferre
     if (isAlive()) {
         ws_.async_read(buffer_,
             [self = shared_from_this()](beast::error_code ec, std::size_t bytes_transferred) {
+                utils::ScopedHandlerTimer timer;
                 self->onRead(ec, bytes_transferred);
             });
     }
@@ -221,8 +570,14 @@ void WebSocketSession::onWrite(beast::error_code ec, std::size_t bytes_transferr
         return;
     }
 
-    std::cout << "[" << COMPONENT_NAME << "] Sent " << bytes_transferred
-              << " bytes to " << client_endpoint_ << std::endl;
+    write_message_.reset(); // Drop our reference to the shared buffer
+
+    utils::LatencyTracker::record(utils::LatencyChannel::SESSION_WRITE,
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - write_started_).count()));
+
+    SIREN_LOG_DEBUG(COMPONENT_NAME, "Sent " << bytes_transferred
+                                    << " bytes to " << client_endpoint_);
 
     // Process next message in queue
     processNextMessage();
@@ -233,31 +588,51 @@ void WebSocketSession::processNextMessage() {
         return;
     }
 
-    std::string message;
-
-    // Get next message from queue manager - SRP compliance
-    if (!queue_manager_->getNextMessage(message)) {
+    // Get next message from queue manager - SRP compliance.
+    // Held in a member: the shared buffer must outlive the asynchronous write.
+    if (!queue_manager_->getNextMessage(write_message_)) {
         return; // No messages to send
     }
 
     // Send the message
-    if (!message.empty()) {
+    if (write_message_ && !write_message_->payload.empty()) {
         write_in_progress_.store(true);
+        write_started_ = std::chrono::steady_clock::now();
+
+        // Frame opcode follows the message, so JSON and binary can share a connection
+        ws_.binary(write_message_->frame_type == FrameType::BINARY);
 
-        ws_.async_write(boost::asio::buffer(message),
+        ws_.async_write(boost::asio::buffer(write_message_->payload),
             [self = shared_from_this()](beast::error_code ec, std::size_t bytes_transferred) {
+                utils::ScopedHandlerTimer timer;
                 self->onWrite(ec, bytes_transferred);
             });
     }
 }
 
-void WebSocketSession::enqueueMessage(const std::string& message) {
+void WebSocketSession::postMessage(SharedMessage message) {
+    boost::asio::post(ws_.get_executor(),
+        [self = shared_from_this(), message = std::move(message)]() mutable {
+            utils::ScopedHandlerTimer timer;
+            self->enqueueMessage(std::move(message));
+        });
+}
+
+void WebSocketSession::enqueueMessage(SharedMessage message) {
     if (!isAlive() || !queue_manager_) {
         return;
     }
 
+    // Drop live sonar already sent in the replay; the first newer message ends the check
+    if (replay_pending_ && message->tag.kind != MessageKind::GENERIC && message->tag.sequence != 0) {
+        if (!utils::ReplayRing::isAfter(message->tag.sequence, replay_sequence_)) {
+            return;
+        }
+        replay_pending_ = false;
+    }
+
     // Delegate to queue manager - SRP compliance
-    bool message_queued = queue_manager_->enqueueMessage(message, write_in_progress_);
+    bool message_queued = queue_manager_->enqueueMessage(std::move(message), write_in_progress_);
     
     // Start writing if message was queued and no write in progress
     if (message_queued && !write_in_progress_.load()) {
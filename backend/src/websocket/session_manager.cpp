@@ -10,21 +10,25 @@
 #include "websocket/session_manager.hpp"
 #include "websocket/session.hpp" // For WebSocketSession definition
 #include "utils/error_handler.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
 #include <algorithm>
 
 namespace siren::websocket {
 
+namespace {
+    constexpr size_t INITIAL_SESSION_CAPACITY = 32;  // Avoids rehashing for typical client counts
+}
+
 SessionManager::SessionManager()
     : sessions_mutex_()
-    , active_sessions_()
+    , active_sessions_(std::make_shared<const SessionContainer>())
+    , session_index_()
     , session_callback_(nullptr)
     , cleanup_counter_(0)
 {
-    std::cout << "[" << COMPONENT_NAME << "] Initializing session manager" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing session manager");
 
-    // Reserve reasonable capacity to avoid frequent reallocations
-    active_sessions_.reserve(32); // SSOT for initial capacity
+    session_index_.reserve(INITIAL_SESSION_CAPACITY);
 }
 
 SessionManager::~SessionManager() {
@@ -42,17 +46,20 @@ std::shared_ptr<WebSocketSession> SessionManager::createSession(
         // Get client endpoint for logging
         const std::string endpoint = session->getClientEndpoint();
 
-        // Add to active sessions (thread-safe)
+        // Publish a snapshot including the new session (copy-on-write)
         {
             std::lock_guard<std::mutex> lock(sessions_mutex_);
-            active_sessions_.push_back(session);
+            SessionContainer sessions(*active_sessions_);
+            session_index_[session.get()] = sessions.size();
+            sessions.push_back(session);
+            publishSessions(std::move(sessions));
         }
 
         // Notify session creation
         notifySessionEvent(endpoint, true);
 
-        std::cout << "[" << COMPONENT_NAME << "] Created session for " << endpoint
-                  << " (total: " << getActiveSessionCount() << ")" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Created session for " << endpoint
+                                       << " (total: " << getActiveSessionCount() << ")");
 
         return session;
 
@@ -71,13 +78,24 @@ void SessionManager::removeSession(std::shared_ptr<WebSocketSession> session) {
     const std::string endpoint = session->getClientEndpoint();
     bool removed = false;
 
-    // Remove from active sessions (thread-safe)
+    // Publish a snapshot without the session (copy-on-write)
     {
         std::lock_guard<std::mutex> lock(sessions_mutex_);
 
-        auto it = std::find(active_sessions_.begin(), active_sessions_.end(), session);
-        if (it != active_sessions_.end()) {
-            active_sessions_.erase(it);
+        // O(1) lookup; order is not significant, so the last session fills the gap
+        const auto found = session_index_.find(session.get());
+        if (found != session_index_.end()) {
+            const size_t position = found->second;
+            session_index_.erase(found);
+
+            SessionContainer sessions(*active_sessions_);
+            if (position + 1 != sessions.size()) {
+                sessions[position] = std::move(sessions.back());
+                session_index_[sessions[position].get()] = position;
+            }
+            sessions.pop_back();
+            publishSessions(std::move(sessions));
+            retireQueueStatistics(*session);
             removed = true;
         }
     }
@@ -89,34 +107,27 @@ void SessionManager::removeSession(std::shared_ptr<WebSocketSession> session) {
         // Check if cleanup is needed
         checkPeriodicCleanup();
 
-        std::cout << "[" << COMPONENT_NAME << "] Removed session for " << endpoint
-                  << " (total: " << getActiveSessionCount() << ")" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Removed session for " << endpoint
+                                       << " (total: " << getActiveSessionCount() << ")");
     }
 }
 
-SessionManager::SessionContainer SessionManager::getActiveSessions() const {
-    std::lock_guard<std::mutex> lock(sessions_mutex_);
-    return active_sessions_; // Copy for thread safety
+SessionManager::SessionSnapshot SessionManager::getActiveSessions() const {
+    return std::atomic_load(&active_sessions_);
 }
 
 size_t SessionManager::getActiveSessionCount() const noexcept {
-    std::lock_guard<std::mutex> lock(sessions_mutex_);
-    return active_sessions_.size();
+    return std::atomic_load(&active_sessions_)->size();
 }
 
 void SessionManager::closeAllSessions() {
-    std::cout << "[" << COMPONENT_NAME << "] Closing all sessions..." << std::endl;
-
-    SessionContainer sessions_to_close;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Closing all sessions...");
 
-    // Get copy of all sessions (thread-safe)
-    {
-        std::lock_guard<std::mutex> lock(sessions_mutex_);
-        sessions_to_close = active_sessions_;
-    }
+    // Snapshot keeps every session alive while closing
+    const SessionSnapshot sessions_to_close = getActiveSessions();
 
     // Close each session
-    for (auto& session : sessions_to_close) {
+    for (const auto& session : *sessions_to_close) {
         if (session && session->isAlive()) {
             try {
                 session->close();
@@ -127,41 +138,74 @@ void SessionManager::closeAllSessions() {
         }
     }
 
-    // Clear the active sessions container
+    // Publish an empty registry
     {
         std::lock_guard<std::mutex> lock(sessions_mutex_);
-        active_sessions_.clear();
+        for (const auto& session : *active_sessions_) {
+            if (session) {
+                retireQueueStatistics(*session);
+            }
+        }
+        session_index_.clear();
+        publishSessions(SessionContainer());
     }
 
-    std::cout << "[" << COMPONENT_NAME << "] All sessions closed" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "All sessions closed");
 }
 
 void SessionManager::cleanupClosedSessions() {
-    size_t initial_count = 0;
     size_t cleaned_count = 0;
+    size_t remaining_count = 0;
 
-    // Remove dead sessions (thread-safe)
+    // Publish a snapshot of live sessions only (copy-on-write)
     {
         std::lock_guard<std::mutex> lock(sessions_mutex_);
-        initial_count = active_sessions_.size();
 
-        // Remove sessions that are no longer alive
-        active_sessions_.erase(
-            std::remove_if(active_sessions_.begin(), active_sessions_.end(),
-                          [](const std::shared_ptr<WebSocketSession>& session) {
-                              return !session || !session->isAlive();
-                          }),
-            active_sessions_.end());
+        SessionContainer sessions;
+        sessions.reserve(active_sessions_->size());
+        session_index_.clear();
+        for (const auto& session : *active_sessions_) {
+            if (session && session->isAlive()) {
+                session_index_[session.get()] = sessions.size();
+                sessions.push_back(session);
+            } else if (session) {
+                retireQueueStatistics(*session);
+            }
+        }
 
-        cleaned_count = initial_count - active_sessions_.size();
+        cleaned_count = active_sessions_->size() - sessions.size();
+        remaining_count = sessions.size();
+        if (cleaned_count > 0) {
+            publishSessions(std::move(sessions));
+        }
     }
 
     if (cleaned_count > 0) {
-        std::cout << "[" << COMPONENT_NAME << "] Cleaned up " << cleaned_count
-                  << " closed sessions (remaining: " << getActiveSessionCount() << ")" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Cleaned up " << cleaned_count
+                                       << " closed sessions (remaining: " << remaining_count << ")");
     }
 }
 
+data::QueueStatistics SessionManager::getRetiredQueueStatistics() const {
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    return retired_queues_;
+}
+
+void SessionManager::retireQueueStatistics(const WebSocketSession& session) {
+    const data::QueueStatistics statistics = session.getQueueStatistics();
+
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    retired_queues_.peak_bytes_queued = std::max(retired_queues_.peak_bytes_queued, statistics.peak_bytes_queued);
+    retired_queues_.messages_dropped += statistics.messages_dropped;
+    retired_queues_.messages_conflated += statistics.messages_conflated;
+    retired_queues_.messages_decimated += statistics.messages_decimated;
+}
+
+void SessionManager::publishSessions(SessionContainer&& sessions) {
+    std::atomic_store(&active_sessions_,
+                      SessionSnapshot(std::make_shared<const SessionContainer>(std::move(sessions))));
+}
+
 void SessionManager::setSessionCallback(SessionEventCallback callback) {
     session_callback_ = std::move(callback);
 }
@@ -9,7 +9,7 @@
 
 #include "websocket/statistics_collector.hpp"
 #include "utils/error_handler.hpp"
-#include <iostream>
+#include "utils/logger.hpp"
 
 namespace siren::websocket {
 
@@ -24,7 +24,7 @@ StatisticsCollector::StatisticsCollector()
     , start_time_(std::chrono::steady_clock::now())
     , stats_mutex_()
 {
-    std::cout << "[" << COMPONENT_NAME << "] Initializing statistics collector" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Initializing statistics collector");
 }
 
 StatisticsCollector::~StatisticsCollector() {
@@ -50,7 +50,7 @@ bool StatisticsCollector::initialize() {
 
         initialized_.store(true);
 
-        std::cout << "[" << COMPONENT_NAME << "] Initialized successfully" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Initialized successfully");
         return true;
 
     } catch (const std::exception& e) {
@@ -78,7 +78,7 @@ bool StatisticsCollector::start() {
     try {
         running_.store(true);
 
-        std::cout << "[" << COMPONENT_NAME << "] Started successfully" << std::endl;
+        SIREN_LOG_INFO(COMPONENT_NAME, "Started successfully");
         return true;
 
     } catch (const std::exception& e) {
@@ -93,19 +93,19 @@ void StatisticsCollector::stop() {
         return;
     }
 
-    std::cout << "[" << COMPONENT_NAME << "] Stopping statistics collection..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Stopping statistics collection...");
 
     running_.store(false);
 
     // Print final statistics
     const auto final_stats = getStatistics(0); // No active connections when stopping
-    std::cout << "[" << COMPONENT_NAME << "] Final statistics:" << std::endl;
-    std::cout << "  - Connections accepted: " << final_stats.connections_accepted << std::endl;
-    std::cout << "  - Messages sent: " << final_stats.messages_sent << std::endl;
-    std::cout << "  - Connection errors: " << final_stats.connection_errors << std::endl;
-    std::cout << "  - Uptime: " << final_stats.uptime_seconds << " seconds" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Final statistics: "
+                                   << final_stats.connections_accepted << " connections accepted, "
+                                   << final_stats.messages_sent << " messages sent, "
+                                   << final_stats.connection_errors << " connection errors, "
+                                   << final_stats.uptime_seconds << " s uptime");
 
-    std::cout << "[" << COMPONENT_NAME << "] Stopped" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Stopped");
 }
 
 bool StatisticsCollector::isRunning() const noexcept {
@@ -163,7 +163,7 @@ data::WebSocketStatistics StatisticsCollector::getStatistics(size_t active_conne
 void StatisticsCollector::resetStatistics() {
     std::lock_guard<std::mutex> lock(stats_mutex_);
 
-    std::cout << "[" << COMPONENT_NAME << "] Resetting all statistics..." << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Resetting all statistics...");
 
     // Reset all counters atomically
     initializeCounters();
@@ -171,7 +171,7 @@ void StatisticsCollector::resetStatistics() {
     // Reset start time
     start_time_ = std::chrono::steady_clock::now();
 
-    std::cout << "[" << COMPONENT_NAME << "] Statistics reset complete" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Statistics reset complete");
 }
 
 uint64_t StatisticsCollector::getUptimeSeconds() const noexcept {
@@ -206,7 +206,7 @@ bool StatisticsCollector::validateStatistics() const {
     }
 
     // Log validation success for debugging
-    std::cout << "[" << COMPONENT_NAME << "] Statistics validation passed" << std::endl;
+    SIREN_LOG_INFO(COMPONENT_NAME, "Statistics validation passed");
     return true;
 }
 
@@ -0,0 +1,187 @@
+/**
+ * @file subscription_filter.cpp
+ * @brief Implementation of per-client subscription filter
+ * @author KostasAndroulidakis
+ * @date 2025
+ */
+
+#include "websocket/subscription_filter.hpp"
+#include "constants/message.hpp"
+#include <limits>
+#include <sstream>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+namespace siren::websocket {
+
+// SSOT for subscription parsing constants (MISRA C++ Rule 5.0.1)
+namespace {
+    namespace pt = boost::property_tree;
+    namespace msg = siren::constants::message;
+    namespace sub = siren::constants::communication::subscription;
+
+    constexpr uint32_t MICROSECONDS_PER_SECOND = 1000000;
+    constexpr size_t SECTOR_BOUNDS = 2;  // [start, end]
+
+    /// Topic carried by a message type name, or COUNT if unknown
+    SubscriptionTopic topicForType(const std::string& type) {
+        if (type == msg::json_types::SONAR_DATA || type == msg::json_types::SONAR_BATCH) {
+            return SubscriptionTopic::SONAR;
+        }
+        if (type == msg::json_types::ENVIRONMENT_DATA) {
+            return SubscriptionTopic::ENVIRONMENT;
+        }
+        if (type == msg::json_types::PERFORMANCE_METRICS) {
+            return SubscriptionTopic::METRICS;
+        }
+        if (type == msg::json_types::STATUS_UPDATE) {
+            return SubscriptionTopic::STATUS;
+        }
+        return SubscriptionTopic::COUNT;
+    }
+}
+
+SubscriptionFilter::SubscriptionFilter()
+    : angles_()
+    , topics_()
+    , min_distance_cm_(std::numeric_limits<int16_t>::min())
+    , max_distance_cm_(std::numeric_limits<int16_t>::max())
+    , max_rate_hz_(0)
+    , min_interval_us_(0)
+    , spatial_(false)
+{
+    angles_.set();
+    topics_.set();
+}
+
+SubscriptionParseResult SubscriptionFilter::parse(const std::string& message,
+                                                  SubscriptionFilter& filter,
+                                                  std::string& error) {
+    if (message.size() > sub::MAX_MESSAGE_BYTES) {
+        error = "control message exceeds " + std::to_string(sub::MAX_MESSAGE_BYTES) + " bytes";
+        return SubscriptionParseResult::INVALID;
+    }
+
+    try {
+        pt::ptree tree;
+        std::istringstream stream(message);
+        pt::read_json(stream, tree);
+
+        if (tree.get<std::string>(msg::json_fields::TYPE, "") != msg::json_types::SUBSCRIBE) {
+            return SubscriptionParseResult::NOT_SUBSCRIPTION;
+        }
+
+        SubscriptionFilter parsed;
+
+        // Sectors: union of inclusive [start, end] angle ranges
+        const auto sectors = tree.get_child_optional(msg::json_fields::SECTORS);
+        if (sectors && !sectors->empty()) {
+            if (sectors->size() > sub::MAX_SECTORS) {
+                error = "more than " + std::to_string(sub::MAX_SECTORS) + " sectors";
+                return SubscriptionParseResult::INVALID;
+            }
+            parsed.angles_.reset();
+            for (const auto& sector : *sectors) {
+                if (sector.second.size() != SECTOR_BOUNDS) {
+                    error = "sector must be [start, end]";
+                    return SubscriptionParseResult::INVALID;
+                }
+                const int start = sector.second.front().second.get_value<int>();
+                const int end = sector.second.back().second.get_value<int>();
+                if (start < 0 || end >= static_cast<int>(ANGLE_BIN_COUNT) || start > end) {
+                    error = "sector [" + std::to_string(start) + ", " + std::to_string(end) + "] out of range";
+                    return SubscriptionParseResult::INVALID;
+                }
+                for (int angle = start; angle <= end; ++angle) {
+                    parsed.angles_.set(static_cast<size_t>(angle));
+                }
+            }
+        }
+
+        // Range gate
+        const int min_distance = tree.get<int>(msg::json_fields::MIN_DISTANCE_CM, parsed.min_distance_cm_);
+        const int max_distance = tree.get<int>(msg::json_fields::MAX_DISTANCE_CM, parsed.max_distance_cm_);
+        if (min_distance > max_distance
+            || min_distance < std::numeric_limits<int16_t>::min()
+            || max_distance > std::numeric_limits<int16_t>::max()) {
+            error = "invalid distance gate";
+            return SubscriptionParseResult::INVALID;
+        }
+        parsed.min_distance_cm_ = static_cast<int16_t>(min_distance);
+        parsed.max_distance_cm_ = static_cast<int16_t>(max_distance);
+
+        // Topics by message type name
+        const auto types = tree.get_child_optional(msg::json_fields::TYPES);
+        if (types && !types->empty()) {
+            parsed.topics_.reset();
+            for (const auto& type : *types) {
+                const std::string name = type.second.get_value<std::string>();
+                const SubscriptionTopic topic = topicForType(name);
+                if (topic == SubscriptionTopic::COUNT) {
+                    error = "unknown message type '" + name + "'";
+                    return SubscriptionParseResult::INVALID;
+                }
+                parsed.topics_.set(static_cast<size_t>(topic));
+            }
+        }
+
+        // Per-topic rate cap
+        const uint32_t max_rate_hz = tree.get<uint32_t>(msg::json_fields::MAX_RATE_HZ, 0);
+        if (max_rate_hz > sub::MAX_RATE_HZ) {
+            error = "max_rate_hz above " + std::to_string(sub::MAX_RATE_HZ);
+            return SubscriptionParseResult::INVALID;
+        }
+        parsed.max_rate_hz_ = max_rate_hz;
+        parsed.min_interval_us_ = (max_rate_hz > 0) ? (MICROSECONDS_PER_SECOND / max_rate_hz) : 0;
+
+        parsed.spatial_ = !parsed.angles_.all()
+            || (parsed.min_distance_cm_ != std::numeric_limits<int16_t>::min())
+            || (parsed.max_distance_cm_ != std::numeric_limits<int16_t>::max());
+
+        filter = parsed;
+        return SubscriptionParseResult::SUBSCRIPTION;
+
+    } catch (const pt::ptree_error& e) {
+        error = e.what();
+        return SubscriptionParseResult::INVALID;
+    }
+}
+
+bool SubscriptionFilter::acceptsTopic(SubscriptionTopic topic) const noexcept {
+    return topic < SubscriptionTopic::COUNT && topics_.test(static_cast<size_t>(topic));
+}
+
+bool SubscriptionFilter::acceptsPoint(int16_t angle, int16_t distance_cm) const noexcept {
+    if (!spatial_) {
+        return true;
+    }
+    return angle >= 0
+        && static_cast<size_t>(angle) < ANGLE_BIN_COUNT
+        && angles_.test(static_cast<size_t>(angle))
+        && distance_cm >= min_distance_cm_
+        && distance_cm <= max_distance_cm_;
+}
+
+bool SubscriptionFilter::isSpatial() const noexcept {
+    return spatial_;
+}
+
+uint32_t SubscriptionFilter::getMinIntervalUs() const noexcept {
+    return min_interval_us_;
+}
+
+std::string SubscriptionFilter::describe() const {
+    std::ostringstream oss;
+    oss << angles_.count() << "/" << ANGLE_BIN_COUNT << " angles";
+    if (min_distance_cm_ != std::numeric_limits<int16_t>::min()
+        || max_distance_cm_ != std::numeric_limits<int16_t>::max()) {
+        oss << ", " << min_distance_cm_ << "-" << max_distance_cm_ << "cm";
+    }
+    oss << ", topics " << topics_.to_string();
+    if (max_rate_hz_ > 0) {
+        oss << ", " << max_rate_hz_ << "Hz";
+    }
+    return oss.str();
+}
+
+} // namespace siren::websocket
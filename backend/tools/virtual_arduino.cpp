@@ -0,0 +1,441 @@
+/**
+ * @file virtual_arduino.cpp
+ * @brief Pseudo-terminal Arduino stand-in for load and latency testing
+ * @author KostasAndroulidakis
+ * @date 2025
+ *
+ * Opens a PTY and emulates firmware/communication.ino on it: ASCII
+ * sendSonarData / sendCalibratedSonarData lines, the "PROTO BIN" handshake
+ * and COBS + CRC16 binary frames. The backend attaches to the slave side
+ * like a real /dev/ttyACM* (SIREN_backend --port <path>).
+ *
+ * Rates are not limited by servo or HC-SR04 timing, so the tool can drive
+ * the backend far beyond what the hardware produces.
+ */
+
+#include "constants/communication.hpp"
+#include "constants/hardware.hpp"
+#include "serial/binary_frame_decoder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace {
+    namespace hw = siren::constants::hardware;
+    namespace comm = siren::constants::communication;
+    namespace frame = hw::arduino::binary_frame;
+
+    /// Wire format emitted on the PTY
+    enum class Format : uint8_t {
+        ASCII,       ///< "Angle: X - Distance: Y"
+        CALIBRATED,  ///< ASCII with Temp/Humidity/SoundSpeed trailer
+        BINARY       ///< COBS frames from the first sample, announced with an unsolicited ACK
+    };
+
+    struct Options {
+        std::string link_path;
+        Format format = Format::CALIBRATED;
+        double rate_hz = 20.0;                          ///< 0 = as fast as possible
+        int step_degrees = hw::servo::STEP_SIZE_DEGREES;
+        double noise_cm = 1.0;                          ///< Gaussian noise standard deviation
+        uint32_t burst_size = 0;                        ///< Samples per burst, 0 = steady rate
+        uint32_t burst_pause_ms = 0;                    ///< Pause between bursts
+        uint64_t count = 0;                             ///< Samples to send, 0 = unlimited
+        uint32_t seed = 1;
+        bool handshake = true;                          ///< Answer "PROTO BIN" like the firmware
+    };
+
+    /// Simulated environment (DHT11 mid-range, sound speed at 20°C)
+    constexpr float BASE_TEMPERATURE_C = 22.0f;
+    constexpr float BASE_HUMIDITY_PERCENT = 55.0f;
+    constexpr float TEMPERATURE_DRIFT_PER_SWEEP_C = 0.1f;
+    constexpr uint32_t DRIFT_PERIOD_SWEEPS = 20;
+
+    /// Sound speed model from firmware/physics.ino: v = 331.3 + 0.6 x T (m/s)
+    constexpr float BASE_SOUND_SPEED_M_S = 331.3f;
+    constexpr float TEMP_COEFFICIENT_M_S_PER_C = 0.6f;
+    constexpr float M_S_TO_CM_US = 0.0001f;
+
+    /// Simulated scene: wall with a slow ripple plus one close target
+    constexpr double WALL_DISTANCE_CM = 250.0;
+    constexpr double WALL_RIPPLE_CM = 100.0;
+    constexpr double TARGET_DISTANCE_CM = 60.0;
+    constexpr int TARGET_MIN_ANGLE = 80;
+    constexpr int TARGET_MAX_ANGLE = 96;
+
+    constexpr size_t COMMAND_BUFFER_LIMIT = 64;
+    constexpr double DEGREES_TO_RADIANS = 3.14159265358979323846 / 180.0;
+
+    std::atomic<bool> g_stop{false};
+
+    void onSignal(int) {
+        g_stop.store(true);
+    }
+
+    void printUsage(const char* program) {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --link <path>        Create symlink to the PTY slave (e.g. /tmp/ttyACM-virtual)\n"
+                  << "  --format <f>         ascii | calibrated | binary (default calibrated)\n"
+                  << "  --rate <hz>          Samples per second, 0 = as fast as possible (default 20)\n"
+                  << "  --step <deg>         Servo step size (default " << hw::servo::STEP_SIZE_DEGREES << ")\n"
+                  << "  --noise <cm>         Gaussian distance noise stddev (default 1)\n"
+                  << "  --burst <n>          Send n samples back-to-back per burst\n"
+                  << "  --burst-pause <ms>   Pause between bursts\n"
+                  << "  --count <n>          Stop after n samples (default unlimited)\n"
+                  << "  --seed <n>           Noise RNG seed (default 1)\n"
+                  << "  --no-handshake       Ignore \"" << comm::serial::BINARY_MODE_COMMAND
+                  << "\" like legacy firmware\n";
+    }
+
+    bool parseOptions(int argc, char* argv[], Options& options) {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            const bool has_value = (i + 1 < argc);
+
+            if (arg == "--no-handshake") {
+                options.handshake = false;
+            } else if (arg == "--link" && has_value) {
+                options.link_path = argv[++i];
+            } else if (arg == "--format" && has_value) {
+                const std::string value = argv[++i];
+                if (value == "ascii") {
+                    options.format = Format::ASCII;
+                } else if (value == "calibrated") {
+                    options.format = Format::CALIBRATED;
+                } else if (value == "binary") {
+                    options.format = Format::BINARY;
+                } else {
+                    return false;
+                }
+            } else if (arg == "--rate" && has_value) {
+                options.rate_hz = std::strtod(argv[++i], nullptr);
+            } else if (arg == "--step" && has_value) {
+                options.step_degrees = std::max(1, std::atoi(argv[++i]));
+            } else if (arg == "--noise" && has_value) {
+                options.noise_cm = std::strtod(argv[++i], nullptr);
+            } else if (arg == "--burst" && has_value) {
+                options.burst_size = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            } else if (arg == "--burst-pause" && has_value) {
+                options.burst_pause_ms = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            } else if (arg == "--count" && has_value) {
+                options.count = std::strtoull(argv[++i], nullptr, 10);
+            } else if (arg == "--seed" && has_value) {
+                options.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            } else {
+                return false;
+            }
+        }
+        return options.rate_hz >= 0.0 && options.noise_cm >= 0.0;
+    }
+
+    /**
+     * @brief Bidirectional sweep and scene model (mirrors sonar.ino)
+     */
+    class SweepSimulator {
+    public:
+        SweepSimulator(int step_degrees, double noise_cm, uint32_t seed)
+            : step_(step_degrees)
+            , angle_(hw::servo::MIN_ANGLE_DEGREES)
+            , direction_(1)
+            , sweeps_(0)
+            , rng_(seed)
+            , noise_(0.0, noise_cm > 0.0 ? noise_cm : 1.0)
+            , noisy_(noise_cm > 0.0) {}
+
+        int angle() const noexcept { return angle_; }
+
+        int distance() {
+            double cm = WALL_DISTANCE_CM + WALL_RIPPLE_CM * std::sin(3.0 * angle_ * DEGREES_TO_RADIANS);
+            if (angle_ >= TARGET_MIN_ANGLE && angle_ <= TARGET_MAX_ANGLE) {
+                cm = TARGET_DISTANCE_CM;
+            }
+            if (noisy_) {
+                cm += noise_(rng_);
+            }
+            return static_cast<int>(std::clamp(std::lround(cm),
+                                               static_cast<long>(hw::sensor::MIN_DISTANCE_CM),
+                                               static_cast<long>(hw::sensor::MAX_DISTANCE_CM)));
+        }
+
+        float temperature() const noexcept {
+            return BASE_TEMPERATURE_C + TEMPERATURE_DRIFT_PER_SWEEP_C * static_cast<float>(sweeps_ % DRIFT_PERIOD_SWEEPS);
+        }
+
+        float humidity() const noexcept { return BASE_HUMIDITY_PERCENT; }
+
+        float soundSpeed() const noexcept {
+            return (BASE_SOUND_SPEED_M_S + TEMP_COEFFICIENT_M_S_PER_C * temperature()) * M_S_TO_CM_US;
+        }
+
+        void advance() noexcept {
+            const int next = angle_ + direction_ * step_;
+            if (next > hw::servo::MAX_ANGLE_DEGREES || next < hw::servo::MIN_ANGLE_DEGREES) {
+                direction_ = -direction_;
+                ++sweeps_;
+            }
+            angle_ += direction_ * step_;
+            angle_ = std::clamp<int>(angle_, hw::servo::MIN_ANGLE_DEGREES, hw::servo::MAX_ANGLE_DEGREES);
+        }
+
+    private:
+        int step_;
+        int angle_;
+        int direction_;
+        uint32_t sweeps_;
+        std::mt19937 rng_;
+        std::normal_distribution<double> noise_;
+        bool noisy_;
+    };
+
+    void appendU16(std::vector<uint8_t>& out, uint16_t value) {
+        out.push_back(static_cast<uint8_t>(value & 0xFF));
+        out.push_back(static_cast<uint8_t>(value >> 8));
+    }
+
+    /// Encode one sample exactly like sendSonarFrame() in communication.ino
+    void encodeBinaryFrame(std::string& out, const SweepSimulator& sim, int distance,
+                           bool with_environment, uint32_t timestamp_us) {
+        std::vector<uint8_t> raw;
+        raw.reserve(frame::MAX_PAYLOAD_SIZE + frame::CRC_SIZE);
+        raw.push_back(frame::VERSION);
+        raw.push_back(with_environment ? frame::FLAG_ENVIRONMENT : 0);
+        raw.push_back(static_cast<uint8_t>(sim.angle()));
+        appendU16(raw, static_cast<uint16_t>(distance));
+        for (int shift = 0; shift < 32; shift += 8) {
+            raw.push_back(static_cast<uint8_t>((timestamp_us >> shift) & 0xFF));
+        }
+        if (with_environment) {
+            appendU16(raw, static_cast<uint16_t>(static_cast<int16_t>(std::lround(sim.temperature() * frame::TEMPERATURE_SCALE))));
+            appendU16(raw, static_cast<uint16_t>(std::lround(sim.humidity() * frame::HUMIDITY_SCALE)));
+            appendU16(raw, static_cast<uint16_t>(std::lround(sim.soundSpeed() * frame::SOUND_SPEED_SCALE)));
+        }
+        appendU16(raw, siren::serial::BinaryFrameDecoder::crc16(raw.data(), raw.size()));
+
+        // COBS encode (payload is far below the 254-byte block limit)
+        const size_t base = out.size();
+        out.push_back(0);
+        size_t code_index = base;
+        uint8_t code = 1;
+        for (uint8_t byte : raw) {
+            if (byte == 0) {
+                out[code_index] = static_cast<char>(code);
+                code_index = out.size();
+                out.push_back(0);
+                code = 1;
+            } else {
+                out.push_back(static_cast<char>(byte));
+                ++code;
+            }
+        }
+        out[code_index] = static_cast<char>(code);
+        out.push_back(static_cast<char>(frame::DELIMITER));
+    }
+
+    void encodeAsciiLine(std::string& out, const SweepSimulator& sim, int distance, bool calibrated) {
+        char line[128];
+        int length = 0;
+        if (calibrated) {
+            length = std::snprintf(line, sizeof(line),
+                                   "Angle: %d - Distance: %d - Temp: %.1f - Humidity: %.1f - SoundSpeed: %.5f\r\n",
+                                   sim.angle(), distance, static_cast<double>(sim.temperature()),
+                                   static_cast<double>(sim.humidity()), static_cast<double>(sim.soundSpeed()));
+        } else {
+            length = std::snprintf(line, sizeof(line), "Angle: %d - Distance: %d\r\n", sim.angle(), distance);
+        }
+        out.append(line, static_cast<size_t>(std::max(0, length)));
+    }
+
+    bool writeAll(int fd, const std::string& data) {
+        size_t written = 0;
+        while (written < data.size() && !g_stop.load()) {
+            const ssize_t n = ::write(fd, data.data() + written, data.size() - written);
+            if (n < 0) {
+                if (errno == EINTR || errno == EAGAIN) {
+                    continue;
+                }
+                return false;
+            }
+            written += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    /// Poll host commands without blocking; returns true once "PROTO BIN" arrived
+    bool pollHandshake(int fd, std::string& pending) {
+        pollfd pfd{fd, POLLIN, 0};
+        while (::poll(&pfd, 1, 0) > 0 && (pfd.revents & POLLIN)) {
+            char buffer[COMMAND_BUFFER_LIMIT];
+            const ssize_t n = ::read(fd, buffer, sizeof(buffer));
+            if (n <= 0) {
+                break;
+            }
+            pending.append(buffer, static_cast<size_t>(n));
+        }
+
+        size_t pos = 0;
+        while ((pos = pending.find('\n')) != std::string::npos) {
+            std::string command = pending.substr(0, pos);
+            pending.erase(0, pos + 1);
+            if (!command.empty() && command.back() == '\r') {
+                command.pop_back();
+            }
+            if (command == comm::serial::BINARY_MODE_COMMAND) {
+                return true;
+            }
+        }
+        if (pending.size() > COMMAND_BUFFER_LIMIT) {
+            pending.clear();
+        }
+        return false;
+    }
+
+    int openPseudoTerminal(std::string& slave_path, int& slave_fd) {
+        const int master_fd = ::posix_openpt(O_RDWR | O_NOCTTY);
+        if (master_fd < 0 || ::grantpt(master_fd) != 0 || ::unlockpt(master_fd) != 0) {
+            std::perror("[VirtualArduino] posix_openpt");
+            return -1;
+        }
+
+        const char* name = ::ptsname(master_fd);
+        if (name == nullptr) {
+            std::perror("[VirtualArduino] ptsname");
+            ::close(master_fd);
+            return -1;
+        }
+        slave_path = name;
+
+        // Hold the slave open so writes never see EIO between backend connections,
+        // and put the line discipline in raw mode like a USB CDC device
+        slave_fd = ::open(name, O_RDWR | O_NOCTTY);
+        if (slave_fd >= 0) {
+            termios tio{};
+            if (::tcgetattr(slave_fd, &tio) == 0) {
+                ::cfmakeraw(&tio);
+                ::tcsetattr(slave_fd, TCSANOW, &tio);
+            }
+        }
+        return master_fd;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    std::string slave_path;
+    int slave_fd = -1;
+    const int master_fd = openPseudoTerminal(slave_path, slave_fd);
+    if (master_fd < 0) {
+        return 1;
+    }
+
+    if (!options.link_path.empty()) {
+        ::unlink(options.link_path.c_str());
+        if (::symlink(slave_path.c_str(), options.link_path.c_str()) != 0) {
+            std::perror("[VirtualArduino] symlink");
+        }
+    }
+
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    std::cout << "[VirtualArduino] 🔌 PTY ready: " << slave_path
+              << (options.link_path.empty() ? "" : " (link: " + options.link_path + ")") << std::endl;
+    std::cout << "[VirtualArduino] Attach with: SIREN_backend --port "
+              << (options.link_path.empty() ? slave_path : options.link_path) << std::endl;
+
+    SweepSimulator sim(options.step_degrees, options.noise_cm, options.seed);
+    bool binary = (options.format == Format::BINARY);
+    const bool with_environment = (options.format != Format::ASCII);
+    std::string pending_command;
+    std::string out;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto next_send = start;
+    const auto interval = (options.rate_hz > 0.0)
+        ? std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(1.0 / options.rate_hz))
+        : std::chrono::steady_clock::duration::zero();
+    uint64_t samples = 0;
+    uint64_t bytes = 0;
+
+    // The backend only decodes COBS frames after it has seen the ACK line, so
+    // forced binary mode announces itself as if "PROTO BIN" had been answered
+    if (binary) {
+        out = std::string(comm::serial::BINARY_MODE_ACK) + "\r\n";
+        if (!writeAll(master_fd, out)) {
+            std::perror("[VirtualArduino] write");
+            g_stop.store(true);
+        }
+    }
+
+    while (!g_stop.load() && (options.count == 0 || samples < options.count)) {
+        if (!binary && options.handshake && pollHandshake(master_fd, pending_command)) {
+            out = std::string(comm::serial::BINARY_MODE_ACK) + "\r\n";
+            writeAll(master_fd, out);
+            binary = true;
+            std::cout << "[VirtualArduino] 🤝 Binary protocol negotiated" << std::endl;
+        }
+
+        out.clear();
+        const int distance = sim.distance();
+        const auto now = std::chrono::steady_clock::now();
+        if (binary) {
+            const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(now - start).count();
+            encodeBinaryFrame(out, sim, distance, with_environment, static_cast<uint32_t>(micros));
+        } else {
+            encodeAsciiLine(out, sim, distance, with_environment);
+        }
+
+        if (!writeAll(master_fd, out)) {
+            std::perror("[VirtualArduino] write");
+            break;
+        }
+        ++samples;
+        bytes += out.size();
+        sim.advance();
+
+        // Pacing: bursts, fixed rate, or none
+        if (options.burst_size > 0) {
+            if (samples % options.burst_size == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(options.burst_pause_ms));
+            }
+        } else if (interval.count() > 0) {
+            next_send += interval;
+            std::this_thread::sleep_until(next_send);
+        }
+    }
+
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[VirtualArduino] 📊 " << samples << " samples, " << bytes << " bytes in "
+              << elapsed << " s (" << (elapsed > 0.0 ? samples / elapsed : 0.0) << " samples/s)" << std::endl;
+
+    if (!options.link_path.empty()) {
+        ::unlink(options.link_path.c_str());
+    }
+    if (slave_fd >= 0) {
+        ::close(slave_fd);
+    }
+    ::close(master_fd);
+    return 0;
+}
@@ -7,10 +7,46 @@
  * Handles all serial communication protocols for transmitting sonar data
  * to external systems. Provides a standardized data format for angle
  * and distance measurements.
+ *
+ * Two wire formats are supported:
+ * - ASCII lines at 9600 baud (default, always available as fallback)
+ * - Compact binary frames at 115200 baud, enabled when the host sends
+ *   "PROTO BIN". Frame: COBS(payload + CRC16-CCITT) followed by 0x00.
+ *   Payload (little-endian): version u8, flags u8, angle u8, distance u16,
+ *   micros() u32 [, temperature i16 x10, humidity u16 x10, sound speed u16 x1e5]
  */
 
 // Communication configuration constants
 constexpr int SERIAL_BAUD_RATE = 9600;   ///< Reliable serial communication (Arduino standard)
+constexpr long BINARY_BAUD_RATE = 115200; ///< Baud rate after binary protocol handshake
+
+// Binary protocol handshake (must match backend constants/communication.hpp)
+const char BINARY_MODE_COMMAND[] = "PROTO BIN";   ///< Host request
+const char BINARY_MODE_ACK[] = "ACK PROTO BIN";   ///< Firmware acknowledgement (sent in ASCII)
+constexpr int COMMAND_BUFFER_SIZE = 16;           ///< Longest accepted command plus terminator
+
+// Binary frame layout (must match backend constants/hardware.hpp binary_frame)
+constexpr uint8_t FRAME_VERSION = 1;              ///< Frame format version
+constexpr uint8_t FRAME_FLAG_ENVIRONMENT = 0x01;  ///< Environmental fields present
+constexpr uint8_t FRAME_DELIMITER = 0x00;         ///< COBS frame delimiter
+constexpr int FRAME_BASE_PAYLOAD_SIZE = 9;        ///< version, flags, angle, distance, timestamp
+constexpr int FRAME_ENVIRONMENT_SIZE = 6;         ///< temperature, humidity, sound speed
+constexpr int FRAME_CRC_SIZE = 2;                 ///< CRC16-CCITT
+constexpr int FRAME_MAX_RAW_SIZE = FRAME_BASE_PAYLOAD_SIZE + FRAME_ENVIRONMENT_SIZE + FRAME_CRC_SIZE;
+constexpr uint16_t CRC_POLYNOMIAL = 0x1021;       ///< CRC-16/CCITT-FALSE polynomial
+constexpr uint16_t CRC_INITIAL = 0xFFFF;          ///< CRC-16/CCITT-FALSE initial value
+constexpr float TEMPERATURE_SCALE = 10.0;         ///< 0.1 °C resolution
+constexpr float HUMIDITY_SCALE = 10.0;            ///< 0.1 % resolution
+constexpr float SOUND_SPEED_SCALE = 100000.0;     ///< 1e-5 cm/µs resolution
+
+// Protocol state
+bool binaryProtocolEnabled = false;
+char commandBuffer[COMMAND_BUFFER_SIZE];
+int commandLength = 0;
+
+// Function declarations
+void sendSonarFrame(int angle, int distance, bool hasEnvironment,
+                    float temperature, float humidity, float soundSpeed);
 
 /**
  * @brief Initialize serial communication
@@ -22,6 +58,122 @@ void initCommunication() {
   Serial.begin(SERIAL_BAUD_RATE);
 }
 
+/**
+ * @brief Poll for host commands and handle protocol negotiation
+ *
+ * Non-blocking: consumes only the bytes already received. On "PROTO BIN"
+ * the acknowledgement is sent in ASCII, flushed, and the port is reopened
+ * at the binary baud rate. Unknown commands are ignored.
+ */
+void processCommunicationCommands() {
+  while (Serial.available() > 0) {
+    char c = static_cast<char>(Serial.read());
+
+    if (c == '\r') {
+      continue;
+    }
+
+    if (c != '\n') {
+      if (commandLength < COMMAND_BUFFER_SIZE - 1) {
+        commandBuffer[commandLength++] = c;
+      }
+      continue;
+    }
+
+    commandBuffer[commandLength] = '\0';
+    commandLength = 0;
+
+    if (!binaryProtocolEnabled && strcmp(commandBuffer, BINARY_MODE_COMMAND) == 0) {
+      Serial.println(BINARY_MODE_ACK);
+      Serial.flush();               // ACK must leave at the old baud rate
+      Serial.end();
+      Serial.begin(BINARY_BAUD_RATE);
+      binaryProtocolEnabled = true;
+    }
+  }
+}
+
+/**
+ * @brief Compute CRC-16/CCITT-FALSE
+ * @param data Bytes to checksum
+ * @param length Number of bytes
+ * @return CRC value
+ */
+uint16_t crc16(const uint8_t* data, int length) {
+  uint16_t crc = CRC_INITIAL;
+  for (int i = 0; i < length; i++) {
+    crc ^= static_cast<uint16_t>(data[i]) << 8;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ CRC_POLYNOMIAL) : static_cast<uint16_t>(crc << 1);
+    }
+  }
+  return crc;
+}
+
+/**
+ * @brief Send sonar sample as a COBS-encoded binary frame
+ * @param angle The servo angle in degrees (0-180)
+ * @param distance The measured distance in centimeters
+ * @param hasEnvironment Whether the environmental fields are included
+ * @param temperature Temperature in Celsius
+ * @param humidity Humidity percentage
+ * @param soundSpeed Sound speed in cm/microsecond
+ *
+ * 13 bytes on the wire without environment, 19 bytes with it
+ * (versus roughly 27 and 80 bytes for the ASCII equivalents).
+ */
+void sendSonarFrame(int angle, int distance, bool hasEnvironment,
+                    float temperature, float humidity, float soundSpeed) {
+  uint8_t raw[FRAME_MAX_RAW_SIZE];
+  int length = 0;
+  unsigned long timestamp = micros();
+
+  raw[length++] = FRAME_VERSION;
+  raw[length++] = hasEnvironment ? FRAME_FLAG_ENVIRONMENT : 0;
+  raw[length++] = static_cast<uint8_t>(angle);
+  raw[length++] = static_cast<uint8_t>(distance & 0xFF);
+  raw[length++] = static_cast<uint8_t>((distance >> 8) & 0xFF);
+  for (int i = 0; i < 4; i++) {
+    raw[length++] = static_cast<uint8_t>((timestamp >> (8 * i)) & 0xFF);
+  }
+
+  if (hasEnvironment) {
+    int16_t scaledTemperature = static_cast<int16_t>(round(temperature * TEMPERATURE_SCALE));
+    uint16_t scaledHumidity = static_cast<uint16_t>(round(humidity * HUMIDITY_SCALE));
+    uint16_t scaledSoundSpeed = static_cast<uint16_t>(round(soundSpeed * SOUND_SPEED_SCALE));
+    raw[length++] = static_cast<uint8_t>(scaledTemperature & 0xFF);
+    raw[length++] = static_cast<uint8_t>((scaledTemperature >> 8) & 0xFF);
+    raw[length++] = static_cast<uint8_t>(scaledHumidity & 0xFF);
+    raw[length++] = static_cast<uint8_t>((scaledHumidity >> 8) & 0xFF);
+    raw[length++] = static_cast<uint8_t>(scaledSoundSpeed & 0xFF);
+    raw[length++] = static_cast<uint8_t>((scaledSoundSpeed >> 8) & 0xFF);
+  }
+
+  uint16_t crc = crc16(raw, length);
+  raw[length++] = static_cast<uint8_t>(crc & 0xFF);
+  raw[length++] = static_cast<uint8_t>((crc >> 8) & 0xFF);
+
+  // COBS encode: replace each zero with the distance to the next one
+  uint8_t encoded[FRAME_MAX_RAW_SIZE + 2];
+  int codeIndex = 0;
+  int writeIndex = 1;
+  uint8_t code = 1;
+  for (int i = 0; i < length; i++) {
+    if (raw[i] == 0) {
+      encoded[codeIndex] = code;
+      codeIndex = writeIndex++;
+      code = 1;
+    } else {
+      encoded[writeIndex++] = raw[i];
+      code++;
+    }
+  }
+  encoded[codeIndex] = code;
+  encoded[writeIndex++] = FRAME_DELIMITER;
+
+  Serial.write(encoded, writeIndex);
+}
+
 /**
  * @brief Send sonar measurement data via serial
  * @param angle The servo angle in degrees (0-180)
@@ -31,6 +183,11 @@ void initCommunication() {
  * Example output: "Angle: 90 - Distance: 150"
  */
 void sendSonarData(int angle, int distance) {
+  if (binaryProtocolEnabled) {
+    sendSonarFrame(angle, distance, false, 0.0, 0.0, 0.0);
+    return;
+  }
+
   Serial.print("Angle: ");
   Serial.print(angle);
   Serial.print(" - Distance: ");
@@ -48,6 +205,11 @@ void sendSonarData(int angle, int distance) {
  * Example output: "Angle: 90 - Distance: 150 - Temp: 23.5 - Humidity: 65.2"
  */
 void sendEnhancedSonarData(int angle, int distance, float temperature, float humidity) {
+  if (binaryProtocolEnabled) {
+    sendSonarFrame(angle, distance, true, temperature, humidity, 0.0);
+    return;
+  }
+
   Serial.print("Angle: ");
   Serial.print(angle);
   Serial.print(" - Distance: ");
@@ -70,6 +232,11 @@ void sendEnhancedSonarData(int angle, int distance, float temperature, float hum
  * Example output: "Angle: 90 - Distance: 150 - Temp: 23.5 - Humidity: 65.2 - SoundSpeed: 0.03456"
  */
 void sendCalibratedSonarData(int angle, int distance, float temperature, float humidity, float soundSpeed) {
+  if (binaryProtocolEnabled) {
+    sendSonarFrame(angle, distance, true, temperature, humidity, soundSpeed);
+    return;
+  }
+
   Serial.print("Angle: ");
   Serial.print(angle);
   Serial.print(" - Distance: ");
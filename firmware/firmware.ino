@@ -19,6 +19,7 @@ void initMotor();                           ///< Initialize servo motor (motor.i
 void initSensor();                          ///< Initialize ultrasonic sensor (sensor.ino)
 void initEnvironment();                     ///< Initialize environmental sensor (environment.ino)
 void initCommunication();                   ///< Initialize serial communication (communication.ino)
+void processCommunicationCommands();        ///< Handle host commands / protocol handshake (communication.ino)
 void moveServoToAngle(int angle);           ///< Move servo to specified angle (motor.ino)
 int getDistance();                          ///< Get distance measurement with default sound speed (sensor.ino)
 int getCalibratedDistance(float soundSpeed); ///< Get distance with real-time sound speed (sensor.ino)
@@ -59,8 +60,10 @@ void setup() {
  *
  * Continuously performs enhanced sonar sweeps with environmental monitoring.
  * Uses enhanced mode for comprehensive environmental data collection.
+ * Host commands (binary protocol handshake) are serviced between sweeps.
  */
 void loop() {
+  processCommunicationCommands();
   performEnhancedSonarSweep();
   delay(SWEEP_DELAY_MS);
 }
@@ -37,6 +37,40 @@ constexpr std::int32_t PONG_TIMEOUT_MS = 5000;
 constexpr std::size_t MAX_MESSAGE_SIZE = 65536;  // 64KB
 constexpr std::size_t RECEIVE_BUFFER_SIZE = 8192;  // 8KB
 
+// Binary WebSocket subprotocol (must match backend constants::message::binary_protocol)
+// Frames are fixed-layout, little-endian, unpadded; byte 0 is the frame type.
+namespace BinaryProtocol {
+    constexpr char SUBPROTOCOL[] = "siren.bin.v2";
+    constexpr char SUBPROTOCOL_HEADER[] = "Sec-WebSocket-Protocol";
+
+    constexpr std::uint8_t FRAME_SONAR_DATA = 0x01;
+    constexpr std::uint8_t FRAME_ENVIRONMENT_DATA = 0x02;
+    constexpr std::uint8_t FRAME_SCAN_SNAPSHOT = 0x04;
+    constexpr std::uint8_t FRAME_SONAR_REPLAY = 0x05;
+
+    // Sonar frame: type u8 | quality u8 | angle i16 | distance i16 | timestamp_us u64 | sequence u32
+    constexpr std::size_t SONAR_FRAME_SIZE = 18;
+    constexpr std::size_t SONAR_QUALITY_OFFSET = 1;
+    constexpr std::size_t SONAR_ANGLE_OFFSET = 2;
+    constexpr std::size_t SONAR_DISTANCE_OFFSET = 4;
+    constexpr std::size_t SONAR_TIMESTAMP_OFFSET = 6;
+    constexpr std::size_t SONAR_SEQUENCE_OFFSET = 14;
+
+    // Scan snapshot (sent on connect): type u8 | flags u8 | point_count u16 | reserved u32,
+    // then point_count sonar records without their type byte, in ascending angle order
+    constexpr std::size_t SNAPSHOT_HEADER_SIZE = 8;
+    constexpr std::size_t SNAPSHOT_COUNT_OFFSET = 2;
+    constexpr std::size_t SNAPSHOT_RECORD_SIZE = SONAR_FRAME_SIZE - 1;
+
+    // Sonar replay (sent on resume instead of the snapshot): snapshot layout with
+    // FRAME_SONAR_REPLAY type, records are the missed samples in sequence order
+}
+
+// Resume after reconnect: the backend replays samples after this sequence number
+namespace Resume {
+    constexpr char LAST_SEQ_PARAMETER[] = "last_seq";
+}
+
 } // namespace Network
 } // namespace Constants
 } // namespace siren
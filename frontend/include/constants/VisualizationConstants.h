@@ -47,6 +47,29 @@ constexpr int ANIMATION_FPS = 60;
 constexpr int ANIMATION_INTERVAL_MS = 1000 / ANIMATION_FPS;
 constexpr double DEFAULT_SWEEP_SPEED = 45.0;  // degrees per second
 
+// Frame pacing (repaints coalesced to the display, not the data rate)
+constexpr int DEFAULT_TARGET_FPS = ANIMATION_FPS;
+constexpr int MIN_TARGET_FPS = 1;
+constexpr int MAX_TARGET_FPS = 240;
+constexpr int MAX_DAMAGE_RECTS = 32;                  // More dirty rects than this repaint the whole widget
+constexpr const char* TARGET_FPS_ENV = "SIREN_TARGET_FPS";
+
+// Frame statistics overlay
+constexpr int FPS_WINDOW_MS = 1000;                   // FPS averaged over this window
+constexpr double FRAME_TIME_SMOOTHING = 0.1;          // Exponential smoothing of paint time
+constexpr int FRAME_OVERLAY_MARGIN = 8;
+constexpr int FRAME_OVERLAY_WIDTH = 260;
+constexpr int FRAME_OVERLAY_HEIGHT = 18;
+constexpr const char* FRAME_OVERLAY_SHORTCUT = "F3";
+
+// Phosphor persistence mode (afterglow instead of per-point drawing)
+constexpr double PHOSPHOR_HALF_LIFE_MS = 400.0;       // Glow halves this often
+constexpr double MIN_PHOSPHOR_HALF_LIFE_MS = 50.0;
+constexpr double MAX_PHOSPHOR_HALF_LIFE_MS = 10000.0;
+constexpr double PHOSPHOR_DECAY_STEP_MS = ANIMATION_INTERVAL_MS;  // Shortest fade step (8-bit precision)
+constexpr const char* PHOSPHOR_HALF_LIFE_ENV = "SIREN_PHOSPHOR_HALF_LIFE_MS";
+constexpr const char* PERSISTENCE_SHORTCUT = "F4";
+
 // Data point lifetime
 constexpr std::uint64_t POINT_LIFETIME_MS = 5000;    // 5 seconds
 constexpr std::uint64_t POINT_FADE_START_MS = 3000;  // Start fading at 3 seconds
@@ -65,6 +88,7 @@ namespace colors {
     constexpr const char* TEXT_PRIMARY = "#00FF00";         // Bright green
     constexpr const char* TEXT_SECONDARY = "#00AA00";       // Medium green
     constexpr const char* SCALE_TEXT = "#AAFFAA";           // Light green
+    constexpr const char* OVERLAY_TEXT = "#FFFFFF";         // White
     constexpr const char* WARNING = "#FF4500";              // Orange
     constexpr const char* ERROR = "#FF0000";                // Red
 }
@@ -5,8 +5,10 @@
 // Sonar Data Parser - Single Responsibility: Parse JSON Sonar Messages
 // Compliant with MISRA C++ 2023, SRP, SSOT
 
+#include <QByteArray>
 #include <QJsonObject>
 #include <QString>
+#include <QVector>
 #include <cstdint>
 
 namespace siren {
@@ -22,6 +24,7 @@ struct SonarDataPoint {
     std::uint16_t angle{0};        // Servo angle in degrees (0-180)
     std::uint16_t distance{0};     // Distance in centimeters (2-400)
     std::uint64_t timestamp{0};    // Timestamp in milliseconds
+    std::uint32_t sequence{0};     // Backend broadcast sequence number (0 = none)
     bool valid{false};             // Data validity flag
 
     /**
@@ -67,7 +70,8 @@ public:
         MISSING_FIELDS = 2,    // Required fields missing
         INVALID_ANGLE = 3,     // Angle out of range
         INVALID_DISTANCE = 4,  // Distance out of range
-        UNKNOWN_MESSAGE = 5    // Unknown message type
+        UNKNOWN_MESSAGE = 5,   // Unknown message type
+        INVALID_FRAME = 6      // Malformed binary frame
     };
 
     /**
@@ -88,6 +92,33 @@ public:
     [[nodiscard]] static ParseResult parseJsonText(const QString& jsonText,
                                                    SonarDataPoint& dataPoint);
 
+    /**
+     * @brief Parse siren.bin.v2 binary frame
+     * @param frame Raw binary WebSocket message
+     * @param dataPoint Output sonar data point
+     * @return Parse result status (UNKNOWN_MESSAGE for non-sonar frames)
+     */
+    [[nodiscard]] static ParseResult parseBinaryFrame(const QByteArray& frame,
+                                                      SonarDataPoint& dataPoint);
+
+    /**
+     * @brief Parse siren.bin.v2 scan snapshot (latest reading per angle, sent on connect)
+     * @param frame Raw binary WebSocket message
+     * @param dataPoints Output valid data points (invalid records are skipped)
+     * @return Parse result status (UNKNOWN_MESSAGE for non-snapshot frames)
+     */
+    [[nodiscard]] static ParseResult parseBinarySnapshot(const QByteArray& frame,
+                                                         QVector<SonarDataPoint>& dataPoints);
+
+    /**
+     * @brief Parse siren.bin.v2 sonar replay (samples missed while disconnected, sent on resume)
+     * @param frame Raw binary WebSocket message
+     * @param dataPoints Output valid data points in sequence order (invalid records are skipped)
+     * @return Parse result status (UNKNOWN_MESSAGE for non-replay frames)
+     */
+    [[nodiscard]] static ParseResult parseBinaryReplay(const QByteArray& frame,
+                                                       QVector<SonarDataPoint>& dataPoints);
+
     /**
      * @brief Validate sonar data against hardware constraints
      * @param dataPoint Sonar data to validate
@@ -118,6 +149,32 @@ private:
     [[nodiscard]] static bool extractSonarData(const QJsonObject& jsonObj,
                                                SonarDataPoint& dataPoint);
 
+    /**
+     * @brief Validate a decoded data point and map failures to a result
+     * @param dataPoint Data point to validate (marked valid on success)
+     * @return Parse result status
+     */
+    [[nodiscard]] static ParseResult finalizeDataPoint(SonarDataPoint& dataPoint);
+
+    /**
+     * @brief Decode a sonar record (sonar frame layout without the type byte)
+     * @param record Pointer to the record's first byte
+     * @param dataPoint Output data point
+     * @return Parse result status
+     */
+    [[nodiscard]] static ParseResult decodeSonarRecord(const uchar* record, SonarDataPoint& dataPoint);
+
+    /**
+     * @brief Decode a frame of sonar records (snapshot layout) of the given type
+     * @param frame Raw binary WebSocket message
+     * @param frameType Expected frame type byte
+     * @param dataPoints Output valid data points (invalid records are skipped)
+     * @return Parse result status (UNKNOWN_MESSAGE for other frame types)
+     */
+    [[nodiscard]] static ParseResult parseBinaryRecords(const QByteArray& frame,
+                                                        std::uint8_t frameType,
+                                                        QVector<SonarDataPoint>& dataPoints);
+
     // Hardware constraints (SSOT for sensor specifications)
     static constexpr std::uint16_t MIN_SERVO_ANGLE = 0;        // SG90 minimum angle
     static constexpr std::uint16_t MAX_SERVO_ANGLE = 180;      // SG90 maximum angle
@@ -130,6 +187,7 @@ private:
     static constexpr const char* ANGLE_FIELD = "angle";
     static constexpr const char* DISTANCE_FIELD = "distance";
     static constexpr const char* TIMESTAMP_FIELD = "timestamp";
+    static constexpr const char* SEQUENCE_FIELD = "seq";
     static constexpr const char* SONAR_DATA_TYPE = "sonar_data";
 };
 
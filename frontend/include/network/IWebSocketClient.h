@@ -18,6 +18,7 @@
 #include <QtCore/QObject>
 #include <QtCore/QString>
 #include <QtCore/QUrl>
+#include <cstdint>
 
 namespace siren {
 namespace Network {
@@ -50,6 +51,23 @@ public:
     virtual void sendTextMessage(const QString& message) = 0;
     virtual void sendBinaryMessage(const QByteArray& data) = 0;
 
+    // Stream Position
+    /**
+     * @brief Record a sonar sequence number as received
+     *
+     * Gaps are counted as lost samples; after a reconnect the client
+     * resumes from the highest sequence number recorded.
+     */
+    virtual void acknowledgeSequence(std::uint32_t sequence) = 0;
+
+    /**
+     * @brief Continue from a scan snapshot's newest sequence number
+     *
+     * Samples skipped since the last one recorded are counted as lost,
+     * unless the backend restarted its sequence.
+     */
+    virtual void resyncSequence(std::uint32_t sequence) = 0;
+
     // Connection State
     enum class State {
         Disconnected,
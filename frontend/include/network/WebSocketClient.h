@@ -43,12 +43,15 @@ public:
     bool isConnected() const override;
     void sendTextMessage(const QString& message) override;
     void sendBinaryMessage(const QByteArray& data) override;
+    void acknowledgeSequence(std::uint32_t sequence) override;
+    void resyncSequence(std::uint32_t sequence) override;
     State state() const override;
 
 private slots:
     void onConnected();
     void onDisconnected();
     void onTextMessageReceived(const QString& message);
+    void onBinaryMessageReceived(const QByteArray& data);
     void onError(QAbstractSocket::SocketError error);
     void attemptReconnect();
 
@@ -56,6 +59,8 @@ private:
     // Private implementation methods
     void resetReconnectAttempts();
     std::int32_t calculateReconnectDelay() const;
+    void openConnection();
+    void resetSequence();
 
     // Member variables - MISRA C++ 2008: 11-0-1 - Member data private
     QScopedPointer<QWebSocket> m_webSocket;
@@ -64,6 +69,11 @@ private:
     std::int32_t m_reconnectAttempts;
     bool m_autoReconnect;
     State m_state;
+
+    // Sonar stream position (for resume and loss measurement)
+    std::uint32_t m_lastSequence;
+    bool m_hasSequence;
+    std::uint64_t m_lostSamples;
 };
 
 } // namespace Network
@@ -6,9 +6,16 @@
 // Compliant with MISRA C++ 2023, SRP, SSOT
 
 #include <QWidget>
+#include <QElapsedTimer>
 #include <QPaintEvent>
 #include <QResizeEvent>
+#include <QFont>
+#include <QPixmap>
+#include <QPointF>
+#include <QRegion>
+#include <QStaticText>
 #include <memory>
+#include <vector>
 #include "data/SonarDataParser.h"
 
 namespace siren {
@@ -18,6 +25,8 @@ namespace visualization {
     class PolarCoordinateConverter;
     class SonarDataBuffer;
     class SonarAnimationController;
+    class FrameScheduler;
+    class PhosphorLayer;
 }
 
 namespace ui {
@@ -33,6 +42,13 @@ namespace ui {
  * - Delegates data storage to SonarDataBuffer
  * - Delegates animation timing to SonarAnimationController
  * - Only handles painting and Qt events
+ * - Static layers (background, grid, label text) are built once per
+ *   resize or style change; each frame blits them and draws only the
+ *   data points and sweep line
+ * - Repaints are paced by FrameScheduler: sample and sweep updates only
+ *   mark their screen area dirty, one repaint per frame covers them all
+ * - Optional phosphor persistence: new points are stamped into a fading
+ *   PhosphorLayer image, so frame cost does not depend on retained history
  *
  * MISRA C++ Compliance:
  * - Rule 12.4.1: No dynamic allocation after initialization
@@ -61,6 +77,18 @@ public:
     SonarVisualizationWidget(SonarVisualizationWidget&&) = delete;
     SonarVisualizationWidget& operator=(SonarVisualizationWidget&&) = delete;
 
+    /**
+     * @brief Check if the frame overlay is shown
+     * @return True if visible
+     */
+    [[nodiscard]] bool isFrameOverlayEnabled() const { return m_frameOverlayEnabled; }
+
+    /**
+     * @brief Check if phosphor persistence rendering is active
+     * @return True if points are drawn as fading afterglow
+     */
+    [[nodiscard]] bool isPersistenceEnabled() const { return m_persistenceEnabled; }
+
 public slots:
     /**
      * @brief Update with new sonar data
@@ -79,6 +107,30 @@ public slots:
      */
     void setAnimationEnabled(bool enabled);
 
+    /**
+     * @brief Set repaint rate cap
+     * @param fps Target frames per second
+     */
+    void setTargetFps(int fps);
+
+    /**
+     * @brief Show or hide the frame time / FPS overlay
+     * @param enabled True to show the overlay
+     */
+    void setFrameOverlayEnabled(bool enabled);
+
+    /**
+     * @brief Switch between direct point drawing and phosphor persistence
+     * @param enabled True to render the fading afterglow
+     */
+    void setPersistenceEnabled(bool enabled);
+
+    /**
+     * @brief Set how fast the afterglow fades
+     * @param halfLifeMs Time to half brightness in milliseconds
+     */
+    void setPersistenceHalfLife(double halfLifeMs);
+
 protected:
     /**
      * @brief Paint event handler
@@ -92,7 +144,21 @@ protected:
      */
     void resizeEvent(QResizeEvent* event) override;
 
+    /**
+     * @brief Change event handler (palette, style and font changes invalidate static layers)
+     * @param event Change event
+     */
+    void changeEvent(QEvent* event) override;
+
 private:
+    /**
+     * @brief Pre-laid-out scale label
+     */
+    struct ScaleLabel {
+        QStaticText text;
+        QPointF topLeft;
+    };
+
     /**
      * @brief Initialize widget components
      */
@@ -103,6 +169,44 @@ private:
      */
     void updateDisplayGeometry();
 
+    /**
+     * @brief Render background and grid into the cached pixmap, lay out scale labels
+     */
+    void rebuildStaticLayers();
+
+    /**
+     * @brief Append a scale label centered on a point
+     * @param text Label text
+     * @param center Label center in widget coordinates
+     */
+    void addScaleLabel(const QString& text, const QPointF& center);
+
+    /**
+     * @brief Repaint the damage handed over by the frame scheduler
+     * @param damage Dirty region
+     * @param fullFrame True to repaint the whole widget
+     */
+    void onFrameDue(const QRegion& damage, bool fullFrame);
+
+    /**
+     * @brief Screen area covered by a data point
+     * @param angle Angle in degrees
+     * @param distance Distance in centimeters
+     */
+    [[nodiscard]] QRect pointRect(std::uint16_t angle, std::uint16_t distance) const;
+
+    /**
+     * @brief Screen area swept between two sweep line positions
+     * @param fromAngle Previous sweep angle
+     * @param toAngle New sweep angle
+     */
+    [[nodiscard]] QRect sweepWedgeRect(std::uint16_t fromAngle, std::uint16_t toAngle) const;
+
+    /**
+     * @brief Screen area of the frame overlay
+     */
+    [[nodiscard]] QRect frameOverlayRect() const;
+
     /**
      * @brief Draw background
      * @param painter QPainter instance
@@ -128,16 +232,22 @@ private:
     void drawAngleLines(QPainter& painter) const;
 
     /**
-     * @brief Draw scale labels
+     * @brief Draw cached scale labels
      * @param painter QPainter instance
      */
     void drawScaleLabels(QPainter& painter) const;
 
     /**
-     * @brief Draw data points
+     * @brief Draw data points (one batched drawPoints call)
      * @param painter QPainter instance
+     * @param clip Repainted area; points that cannot touch it are skipped
+     */
+    void drawDataPoints(QPainter& painter, const QRect& clip) const;
+
+    /**
+     * @brief Fade the phosphor layer and stamp the points added since the last frame
      */
-    void drawDataPoints(QPainter& painter) const;
+    void advancePhosphor();
 
     /**
      * @brief Draw sweep line
@@ -151,15 +261,44 @@ private:
      */
     void drawTitle(QPainter& painter) const;
 
+    /**
+     * @brief Draw frame time / FPS overlay
+     * @param painter QPainter instance
+     */
+    void drawFrameOverlay(QPainter& painter) const;
+
     // Component ownership (using unique_ptr for RAII)
     std::unique_ptr<visualization::PolarCoordinateConverter> m_coordinateConverter;
     std::unique_ptr<visualization::SonarDataBuffer> m_dataBuffer;
     std::unique_ptr<visualization::SonarAnimationController> m_animationController;
+    std::unique_ptr<visualization::FrameScheduler> m_frameScheduler;
+    std::unique_ptr<visualization::PhosphorLayer> m_phosphorLayer;
 
     // Display geometry
     QPoint m_centerPoint{0, 0};
     int m_displayRadius{0};
     bool m_geometryValid{false};
+
+    // Cached static layers (rebuilt on resize or style change)
+    QPixmap m_staticLayer;
+    std::vector<ScaleLabel> m_scaleLabels;
+    QFont m_scaleFont;
+    bool m_staticLayersValid{false};
+
+    // Per-frame screen coordinates, sized to the buffer once (no allocation while painting)
+    mutable std::vector<QPointF> m_screenPoints;
+
+    // Monotonic time base for buffered point timestamps
+    QElapsedTimer m_pointClock;
+
+    // Frame pacing
+    std::uint16_t m_lastSweepAngle{0};
+    bool m_frameOverlayEnabled{false};
+
+    // Phosphor persistence
+    QElapsedTimer m_phosphorClock;
+    std::uint64_t m_phosphorStamped{0};  ///< Buffer insertion number of the next point to stamp
+    bool m_persistenceEnabled{false};
 };
 
 } // namespace ui
@@ -0,0 +1,144 @@
+#ifndef SIREN_FRAME_SCHEDULER_H
+#define SIREN_FRAME_SCHEDULER_H
+
+// SIREN Sonar System
+// Frame Scheduler - Single Responsibility: Repaint Pacing ONLY
+// Compliant with MISRA C++ 2023, SRP, SSOT
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QRect>
+#include <QRegion>
+#include <QTimer>
+#include <cstdint>
+
+namespace siren {
+namespace visualization {
+
+/**
+ * @brief Frame scheduler - Single Responsibility: Repaint Pacing
+ *
+ * This class has ONE job: Turn any number of invalidations into at most one
+ * repaint per frame interval. It does NOT render, store data, or decide
+ * what changed.
+ *
+ * Features:
+ * - Dirty rectangles accumulated into one damage region per frame
+ * - Configurable target frame rate, independent of the data rate
+ * - Falls back to a full frame when the damage gets fragmented
+ * - Frame time and FPS measurement for the on-screen overlay
+ *
+ * MISRA C++ Compliance:
+ * - Rule 21.2.1: RAII for timer resource
+ * - Rule 5.0.1: No magic numbers
+ */
+class FrameScheduler final : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Construct frame scheduler
+     * @param parent Parent object (Qt memory management)
+     */
+    explicit FrameScheduler(QObject* parent = nullptr);
+
+    /**
+     * @brief Destructor - RAII cleanup
+     */
+    ~FrameScheduler() override = default;
+
+    // MISRA C++ Rule 12.1.1: Disable copy/move
+    FrameScheduler(const FrameScheduler&) = delete;
+    FrameScheduler& operator=(const FrameScheduler&) = delete;
+    FrameScheduler(FrameScheduler&&) = delete;
+    FrameScheduler& operator=(FrameScheduler&&) = delete;
+
+    /**
+     * @brief Set target frame rate
+     * @param fps Frames per second (clamped to MIN_TARGET_FPS..MAX_TARGET_FPS)
+     */
+    void setTargetFps(int fps);
+
+    /**
+     * @brief Get target frame rate
+     * @return Frames per second
+     */
+    [[nodiscard]] int getTargetFps() const { return m_targetFps; }
+
+    /**
+     * @brief Mark a rectangle dirty and schedule a frame
+     * @param rect Damaged area in widget coordinates
+     */
+    void invalidate(const QRect& rect);
+
+    /**
+     * @brief Mark the whole widget dirty and schedule a frame
+     */
+    void invalidateAll();
+
+    /**
+     * @brief Record the start of a paint
+     */
+    void frameStarted();
+
+    /**
+     * @brief Record the end of a paint (updates frame time and FPS)
+     */
+    void frameFinished();
+
+    /**
+     * @brief Get presented frames per second over the last window
+     * @return Frames per second
+     */
+    [[nodiscard]] double getFps() const { return m_fps; }
+
+    /**
+     * @brief Get smoothed paint duration
+     * @return Milliseconds per frame
+     */
+    [[nodiscard]] double getFrameTimeMs() const { return m_frameTimeMs; }
+
+signals:
+    /**
+     * @brief Emitted once per frame interval while something is dirty
+     * @param damage Accumulated damage (ignore when fullFrame is set)
+     * @param fullFrame True if the whole widget must be repainted
+     */
+    void frameDue(const QRegion& damage, bool fullFrame);
+
+private slots:
+    /**
+     * @brief Hand the accumulated damage to the widget
+     */
+    void onFrameTimer();
+
+private:
+    /**
+     * @brief Arm the frame timer for the next frame slot
+     */
+    void scheduleFrame();
+
+    // Pacing
+    QTimer* m_frameTimer{nullptr};
+    QElapsedTimer m_clock;
+    std::int64_t m_frameIntervalNs{0};
+    std::int64_t m_lastFrameNs{0};
+    int m_targetFps{0};
+
+    // Pending damage
+    QRegion m_damage;
+    bool m_fullFrame{false};
+
+    // Statistics
+    std::int64_t m_paintStartNs{0};
+    std::int64_t m_windowStartNs{0};
+    int m_framesInWindow{0};
+    double m_frameTimeMs{0.0};
+    double m_fps{0.0};
+};
+
+} // namespace visualization
+} // namespace siren
+
+#endif // SIREN_FRAME_SCHEDULER_H
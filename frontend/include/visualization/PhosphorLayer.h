@@ -0,0 +1,111 @@
+#ifndef SIREN_PHOSPHOR_LAYER_H
+#define SIREN_PHOSPHOR_LAYER_H
+
+// SIREN Sonar System
+// Phosphor Layer - Single Responsibility: Persistence Image Accumulation ONLY
+// Compliant with MISRA C++ 2023, SRP, SSOT
+
+#include <QColor>
+#include <QImage>
+#include <QPointF>
+#include <QSize>
+#include <cstddef>
+#include <cstdint>
+
+namespace siren {
+namespace visualization {
+
+/**
+ * @brief Phosphor layer - Single Responsibility: Afterglow Accumulation
+ *
+ * This class has ONE job: Keep a premultiplied ARGB image that fades over
+ * time and receives new echoes, like a long-persistence radar phosphor.
+ * It does NOT decide which points are new, convert coordinates, or paint
+ * the widget.
+ *
+ * Features:
+ * - Exponential decay with a configurable half-life, frame-rate independent
+ * - Decay as one fixed-point multiply over every pixel (SSE2, SWAR fallback)
+ * - New points stamped at full brightness; history costs nothing to keep
+ * - Reports when the image has fully faded so repaints can stop
+ *
+ * MISRA C++ Compliance:
+ * - Rule 12.4.1: Image allocated on resize only
+ * - Rule 5.0.1: No magic numbers
+ */
+class PhosphorLayer final
+{
+public:
+    /**
+     * @brief Construct empty layer
+     */
+    PhosphorLayer();
+
+    // MISRA C++ Rule 12.1.1: Disable copy/move
+    PhosphorLayer(const PhosphorLayer&) = delete;
+    PhosphorLayer& operator=(const PhosphorLayer&) = delete;
+    PhosphorLayer(PhosphorLayer&&) = delete;
+    PhosphorLayer& operator=(PhosphorLayer&&) = delete;
+
+    /**
+     * @brief Reallocate for a new widget size (clears the afterglow)
+     * @param size Widget size in logical pixels
+     * @param devicePixelRatio Screen scale factor
+     */
+    void resize(const QSize& size, qreal devicePixelRatio);
+
+    /**
+     * @brief Fade everything by the time elapsed since the last call
+     * @param elapsedMs Milliseconds since the previous decay
+     */
+    void decay(double elapsedMs);
+
+    /**
+     * @brief Stamp new echoes at full brightness
+     * @param points Screen coordinates
+     * @param count Number of points
+     * @param color Echo color
+     * @param radius Echo radius in logical pixels
+     */
+    void stamp(const QPointF* points, std::size_t count, const QColor& color, int radius);
+
+    /**
+     * @brief Erase the afterglow
+     */
+    void clear();
+
+    /**
+     * @brief Set the time for the glow to fade to half brightness
+     * @param halfLifeMs Half-life in milliseconds
+     */
+    void setHalfLife(double halfLifeMs);
+
+    /**
+     * @brief Check if nothing is left glowing
+     * @return True if the image is fully transparent
+     */
+    [[nodiscard]] bool isDark() const { return m_peak == 0; }
+
+    /**
+     * @brief Get the accumulation image
+     * @return Premultiplied ARGB image in device pixels
+     */
+    [[nodiscard]] const QImage& image() const { return m_image; }
+
+private:
+    /**
+     * @brief Multiply every channel of every pixel by scale / 256
+     * @param scale Fixed-point factor (0-255)
+     */
+    void scalePixels(std::uint32_t scale);
+
+    QImage m_image;
+    double m_halfLifeMs;
+    double m_pendingMs{0.0};     ///< Elapsed time too short to move the 8-bit factor yet
+    std::uint32_t m_peak{0};     ///< Upper bound on any channel value (0 = dark)
+};
+
+} // namespace visualization
+} // namespace siren
+
+#endif // SIREN_PHOSPHOR_LAYER_H
@@ -6,8 +6,13 @@
 // Compliant with MISRA C++ 2023, SRP, SSOT
 
 #include <QPoint>
+#include <QPointF>
+#include <QRectF>
+#include <array>
 #include <cstdint>
 #include <cmath>
+#include "constants/VisualizationConstants.h"
+#include "visualization/SonarDataBuffer.h"
 
 namespace siren {
 namespace visualization {
@@ -24,6 +29,8 @@ namespace visualization {
  * - Screen to polar coordinate conversion
  * - Origin-based transformations
  * - Scale factor support
+ * - Per-degree scaled cos/sin tables, rebuilt when the geometry changes
+ * - Batch conversion of buffered points for a single drawPoints() call
  *
  * MISRA C++ Compliance:
  * - Rule 21.2.1: No dynamic allocation
@@ -33,6 +40,11 @@ namespace visualization {
 class PolarCoordinateConverter final
 {
 public:
+    /**
+     * @brief Construct converter with default geometry (tables built)
+     */
+    PolarCoordinateConverter();
+
     /**
      * @brief Set display center point
      * @param center Center point for polar origin
@@ -59,6 +71,23 @@ public:
      */
     [[nodiscard]] QPoint polarToScreen(std::uint16_t angle, std::uint16_t distance) const;
 
+    /**
+     * @brief Convert a run of buffered points to screen coordinates
+     * @param segment Buffered points (e.g. one of SonarDataBuffer::getSegments())
+     * @param output Destination, room for at least segment.size points
+     * @return Number of points written (invalid points and angles outside the table are skipped)
+     */
+    std::size_t polarToScreen(const SonarDataBuffer::Segment& segment, QPointF* output) const;
+
+    /**
+     * @brief Convert a run of buffered points, keeping only those inside a clip rectangle
+     * @param segment Buffered points (e.g. one of SonarDataBuffer::getSegments())
+     * @param clip Screen area of interest (e.g. the repaint rectangle grown by the point size)
+     * @param output Destination, room for at least segment.size points
+     * @return Number of points written
+     */
+    std::size_t polarToScreen(const SonarDataBuffer::Segment& segment, const QRectF& clip, QPointF* output) const;
+
     /**
      * @brief Convert screen to polar coordinates
      * @param point Screen coordinates
@@ -96,6 +125,11 @@ public:
     [[nodiscard]] std::uint16_t getMaxDistance() const { return m_maxDistance; }
 
 private:
+    /**
+     * @brief Recompute the scaled cos/sin tables for the current radius and range
+     */
+    void rebuildTables();
+
     /**
      * @brief Convert degrees to radians
      * @param degrees Angle in degrees
@@ -115,6 +149,11 @@ private:
     int m_displayRadius{300};
     std::uint16_t m_maxDistance{450};
 
+    // Pixels per centimeter along each whole degree (x right, y up)
+    static constexpr std::size_t ANGLE_TABLE_SIZE = constants::visualization::DISPLAY_MAX_ANGLE + 1;
+    std::array<double, ANGLE_TABLE_SIZE> m_scaledCos{};
+    std::array<double, ANGLE_TABLE_SIZE> m_scaledSin{};
+
     // Math constants (SSOT)
     static constexpr double PI = 3.14159265358979323846;
     static constexpr double DEGREES_TO_RADIANS = PI / 180.0;
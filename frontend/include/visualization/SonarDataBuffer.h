@@ -5,9 +5,12 @@
 // Sonar Data Buffer - Single Responsibility: Data Point Storage with Decay ONLY
 // Compliant with MISRA C++ 2023, SRP, SSOT
 
+#include <array>
 #include <vector>
 #include <cstdint>
+#include <limits>
 #include "data/SonarDataParser.h"
+#include "constants/VisualizationConstants.h"
 
 namespace siren {
 namespace visualization {
@@ -19,10 +22,15 @@ namespace visualization {
  * It does NOT render, convert coordinates, or handle UI.
  *
  * Features:
- * - Fixed-size circular buffer for predictable memory usage
- * - Time-based data point expiration
+ * - Fixed-size ring in insertion (time) order: O(1) insert, expiry advances the head
+ * - Per-angle index (one FIFO chain per degree) for range and latest-per-angle queries
  * - Decay factor calculation for fading effects
- * - Efficient point retrieval
+ * - Oldest-first iteration over at most two contiguous segments
+ * - Monotonic insertion numbers, so consumers can fetch only what is new
+ *
+ * Timestamps passed to addPoint() must not decrease (take them from a
+ * monotonic clock such as QElapsedTimer); expiry stops at the first point
+ * that is still live.
  *
  * MISRA C++ Compliance:
  * - Rule 12.4.1: No dynamic allocation after initialization
@@ -63,6 +71,14 @@ public:
                                           std::uint64_t lifetimeMs) const;
     };
 
+    /**
+     * @brief Contiguous run of buffered points (oldest first)
+     */
+    struct Segment {
+        const BufferedPoint* data{nullptr};
+        std::size_t size{0};
+    };
+
     /**
      * @brief Construct buffer with fixed capacity
      * @param capacity Maximum number of points to store
@@ -77,28 +93,81 @@ public:
     void addPoint(const data::SonarDataPoint& dataPoint, std::uint64_t timestamp);
 
     /**
-     * @brief Remove expired points from buffer
+     * @brief Remove expired points from buffer (advances the head past them)
      * @param currentTime Current time in milliseconds
      * @param lifetimeMs Point lifetime in milliseconds
      */
     void removeExpiredPoints(std::uint64_t currentTime, std::uint64_t lifetimeMs);
 
     /**
-     * @brief Get all valid points
-     * @return Vector of buffered points
+     * @brief Remove expired points, reporting each one before it is dropped
+     * @param currentTime Current time in milliseconds
+     * @param lifetimeMs Point lifetime in milliseconds
+     * @param onExpired Callable taking const BufferedPoint& (e.g. to damage its screen area)
+     */
+    template <typename Visitor>
+    void removeExpiredPoints(std::uint64_t currentTime, std::uint64_t lifetimeMs, Visitor&& onExpired) {
+        while (m_count > 0 && m_points[slotOf(m_oldest)].isExpired(currentTime, lifetimeMs)) {
+            onExpired(m_points[slotOf(m_oldest)]);
+            evictOldest();
+        }
+    }
+
+    /**
+     * @brief Get the oldest stored point (the next one addPoint() overwrites when full)
+     * @return Oldest point, or nullptr if empty
+     */
+    [[nodiscard]] const BufferedPoint* getOldest() const { return (m_count > 0) ? &m_points[slotOf(m_oldest)] : nullptr; }
+
+    /**
+     * @brief Get the stored points as contiguous segments
+     * @return Oldest-first segments; the second is empty unless the ring wraps
+     */
+    [[nodiscard]] std::array<Segment, 2> getSegments() const;
+
+    /**
+     * @brief Get the points added from an insertion number on, as contiguous segments
+     * @param index Absolute insertion number (earlier numbers start at the oldest stored point)
+     * @return Oldest-first segments; the second is empty unless the ring wraps
+     */
+    [[nodiscard]] std::array<Segment, 2> getSegmentsSince(std::uint64_t index) const;
+
+    /**
+     * @brief Get the insertion number the next point will receive
+     * @return Total points ever added (not reset by clear())
      */
-    [[nodiscard]] const std::vector<BufferedPoint>& getPoints() const { return m_points; }
+    [[nodiscard]] std::uint64_t getInsertCount() const { return m_oldest + m_count; }
 
     /**
-     * @brief Get points within angle range
+     * @brief Visit every stored point, oldest first
+     * @param visitor Callable taking const BufferedPoint&
+     */
+    template <typename Visitor>
+    void forEachPoint(Visitor&& visitor) const {
+        for (const Segment& segment : getSegments()) {
+            for (std::size_t i = 0; i < segment.size; ++i) {
+                visitor(segment.data[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Get points within angle range (per-angle index, no full scan)
      * @param minAngle Minimum angle (inclusive)
      * @param maxAngle Maximum angle (inclusive)
-     * @param output Output vector for filtered points
+     * @param output Output vector for filtered points, by angle then oldest first
      */
     void getPointsInAngleRange(std::uint16_t minAngle,
                               std::uint16_t maxAngle,
                               std::vector<BufferedPoint>& output) const;
 
+    /**
+     * @brief Get the most recent point at an angle
+     * @param angle Angle in degrees
+     * @return Latest point, or nullptr if none is stored at that angle
+     */
+    [[nodiscard]] const BufferedPoint* getLatestAtAngle(std::uint16_t angle) const;
+
     /**
      * @brief Clear all buffered points
      */
@@ -108,13 +177,13 @@ public:
      * @brief Get current number of points
      * @return Number of points in buffer
      */
-    [[nodiscard]] std::size_t size() const { return m_points.size(); }
+    [[nodiscard]] std::size_t size() const { return m_count; }
 
     /**
      * @brief Check if buffer is empty
      * @return True if no points stored
      */
-    [[nodiscard]] bool empty() const { return m_points.empty(); }
+    [[nodiscard]] bool empty() const { return m_count == 0; }
 
     /**
      * @brief Get buffer capacity
@@ -135,9 +204,39 @@ public:
     void setFadeStartTime(std::uint64_t fadeStartMs);
 
 private:
-    // Buffer storage
+    /// One index bin per display degree
+    static constexpr std::size_t ANGLE_BIN_COUNT = constants::visualization::DISPLAY_MAX_ANGLE + 1;
+
+    /// Link terminator in the per-angle chains
+    static constexpr std::uint64_t NO_POINT = std::numeric_limits<std::uint64_t>::max();
+
+    /**
+     * @brief Oldest and newest point of one angle (absolute insertion numbers)
+     */
+    struct AngleChain {
+        std::uint64_t oldest{NO_POINT};
+        std::uint64_t newest{NO_POINT};
+    };
+
+    /**
+     * @brief Drop the oldest point and unlink it from its angle chain
+     */
+    void evictOldest();
+
+    /**
+     * @brief Ring slot of an absolute insertion number
+     */
+    [[nodiscard]] std::size_t slotOf(std::uint64_t index) const { return static_cast<std::size_t>(index % m_capacity); }
+
+    // Ring storage: point i (absolute insertion number) lives in slot i % capacity
     std::vector<BufferedPoint> m_points;
+    std::vector<std::uint64_t> m_nextSameAngle;  ///< Per slot: next newer point at the same angle
     std::size_t m_capacity;
+    std::uint64_t m_oldest{0};                   ///< Absolute number of the oldest stored point
+    std::size_t m_count{0};
+
+    // Per-angle index
+    std::array<AngleChain, ANGLE_BIN_COUNT> m_angleChains{};
 
     // Timing parameters
     std::uint64_t m_pointLifetimeMs;
@@ -3,6 +3,8 @@
 // Single Responsibility: Parse JSON Sonar Messages ONLY
 
 #include "data/SonarDataParser.h"
+#include "constants/Network.h"
+#include <QtEndian>
 #include <QJsonDocument>
 #include <QJsonParseError>
 #include <QDateTime>
@@ -65,20 +67,7 @@ SonarDataParser::ParseResult SonarDataParser::parseMessage(const QJsonObject& js
         return ParseResult::MISSING_FIELDS;
     }
 
-    // Validate hardware constraints
-    if (!validateHardwareConstraints(dataPoint)) {
-        // Determine specific validation failure
-        if (dataPoint.angle > MAX_SERVO_ANGLE) {
-            return ParseResult::INVALID_ANGLE;
-        }
-        if (dataPoint.distance < MIN_SENSOR_DISTANCE || dataPoint.distance > MAX_SENSOR_DISTANCE) {
-            return ParseResult::INVALID_DISTANCE;
-        }
-        return ParseResult::INVALID_ANGLE; // Default to angle error
-    }
-
-    dataPoint.valid = true;
-    return ParseResult::SUCCESS;
+    return finalizeDataPoint(dataPoint);
 }
 
 SonarDataParser::ParseResult SonarDataParser::parseJsonText(const QString& jsonText,
@@ -103,6 +92,117 @@ SonarDataParser::ParseResult SonarDataParser::parseJsonText(const QString& jsonT
     return parseMessage(jsonObj, dataPoint);
 }
 
+SonarDataParser::ParseResult SonarDataParser::parseBinaryFrame(const QByteArray& frame,
+                                                               SonarDataPoint& dataPoint)
+{
+    namespace Binary = Constants::Network::BinaryProtocol;
+
+    // Reset data point
+    dataPoint = SonarDataPoint{};
+
+    if (frame.isEmpty()) {
+        return ParseResult::INVALID_FRAME;
+    }
+
+    // Environment and future frame types are not sonar data
+    const auto* bytes = reinterpret_cast<const uchar*>(frame.constData());
+    if (bytes[0] != Binary::FRAME_SONAR_DATA) {
+        return ParseResult::UNKNOWN_MESSAGE;
+    }
+
+    if (static_cast<std::size_t>(frame.size()) != Binary::SONAR_FRAME_SIZE) {
+        return ParseResult::INVALID_FRAME;
+    }
+
+    return decodeSonarRecord(bytes + Binary::SONAR_QUALITY_OFFSET, dataPoint);
+}
+
+SonarDataParser::ParseResult SonarDataParser::parseBinarySnapshot(const QByteArray& frame,
+                                                                  QVector<SonarDataPoint>& dataPoints)
+{
+    return parseBinaryRecords(frame, Constants::Network::BinaryProtocol::FRAME_SCAN_SNAPSHOT, dataPoints);
+}
+
+SonarDataParser::ParseResult SonarDataParser::parseBinaryReplay(const QByteArray& frame,
+                                                                QVector<SonarDataPoint>& dataPoints)
+{
+    return parseBinaryRecords(frame, Constants::Network::BinaryProtocol::FRAME_SONAR_REPLAY, dataPoints);
+}
+
+SonarDataParser::ParseResult SonarDataParser::parseBinaryRecords(const QByteArray& frame,
+                                                                 std::uint8_t frameType,
+                                                                 QVector<SonarDataPoint>& dataPoints)
+{
+    namespace Binary = Constants::Network::BinaryProtocol;
+
+    dataPoints.clear();
+
+    const auto* bytes = reinterpret_cast<const uchar*>(frame.constData());
+    if (frame.isEmpty() || bytes[0] != frameType) {
+        return ParseResult::UNKNOWN_MESSAGE;
+    }
+
+    const auto frameSize = static_cast<std::size_t>(frame.size());
+    if (frameSize < Binary::SNAPSHOT_HEADER_SIZE) {
+        return ParseResult::INVALID_FRAME;
+    }
+
+    const std::size_t count = qFromLittleEndian<quint16>(bytes + Binary::SNAPSHOT_COUNT_OFFSET);
+    if (frameSize != Binary::SNAPSHOT_HEADER_SIZE + count * Binary::SNAPSHOT_RECORD_SIZE) {
+        return ParseResult::INVALID_FRAME;
+    }
+
+    dataPoints.reserve(static_cast<int>(count));
+    for (std::size_t i = 0; i < count; ++i) {
+        SonarDataPoint dataPoint;
+        const uchar* record = bytes + Binary::SNAPSHOT_HEADER_SIZE + i * Binary::SNAPSHOT_RECORD_SIZE;
+        if (decodeSonarRecord(record, dataPoint) == ParseResult::SUCCESS) {
+            dataPoints.append(dataPoint);
+        }
+    }
+
+    return ParseResult::SUCCESS;
+}
+
+SonarDataParser::ParseResult SonarDataParser::decodeSonarRecord(const uchar* record, SonarDataPoint& dataPoint)
+{
+    namespace Binary = Constants::Network::BinaryProtocol;
+
+    // Fixed little-endian layout - no text parsing, no allocation
+    // (record offsets are the sonar frame offsets minus the type byte)
+    const uchar* frame = record - Binary::SONAR_QUALITY_OFFSET;
+    const qint16 angle = qFromLittleEndian<qint16>(frame + Binary::SONAR_ANGLE_OFFSET);
+    const qint16 distance = qFromLittleEndian<qint16>(frame + Binary::SONAR_DISTANCE_OFFSET);
+    if (angle < 0 || distance < 0) {
+        return (angle < 0) ? ParseResult::INVALID_ANGLE : ParseResult::INVALID_DISTANCE;
+    }
+
+    dataPoint.angle = static_cast<std::uint16_t>(angle);
+    dataPoint.distance = static_cast<std::uint16_t>(distance);
+    dataPoint.timestamp = qFromLittleEndian<quint64>(frame + Binary::SONAR_TIMESTAMP_OFFSET);
+    dataPoint.sequence = qFromLittleEndian<quint32>(frame + Binary::SONAR_SEQUENCE_OFFSET);
+
+    return finalizeDataPoint(dataPoint);
+}
+
+SonarDataParser::ParseResult SonarDataParser::finalizeDataPoint(SonarDataPoint& dataPoint)
+{
+    // Validate hardware constraints
+    if (!validateHardwareConstraints(dataPoint)) {
+        // Determine specific validation failure
+        if (dataPoint.angle > MAX_SERVO_ANGLE) {
+            return ParseResult::INVALID_ANGLE;
+        }
+        if (dataPoint.distance < MIN_SENSOR_DISTANCE || dataPoint.distance > MAX_SENSOR_DISTANCE) {
+            return ParseResult::INVALID_DISTANCE;
+        }
+        return ParseResult::INVALID_ANGLE; // Default to angle error
+    }
+
+    dataPoint.valid = true;
+    return ParseResult::SUCCESS;
+}
+
 bool SonarDataParser::validateHardwareConstraints(const SonarDataPoint& dataPoint)
 {
     // Validate servo angle (SG90: 0° to 180°)
@@ -133,6 +233,8 @@ QString SonarDataParser::getErrorDescription(ParseResult result)
             return QString("Distance out of range (2-400cm)");
         case ParseResult::UNKNOWN_MESSAGE:
             return QString("Unknown message type");
+        case ParseResult::INVALID_FRAME:
+            return QString("Malformed binary frame");
     }
 
     // MISRA C++ Rule 16.1.1: All switch statements shall have a default clause
@@ -180,6 +282,12 @@ bool SonarDataParser::extractSonarData(const QJsonObject& jsonObj,
         dataPoint.timestamp = static_cast<std::uint64_t>(QDateTime::currentMSecsSinceEpoch());
     }
 
+    // Extract sequence number (optional, older backends omit it)
+    const QJsonValue sequenceValue = jsonObj[SEQUENCE_FIELD];
+    if (sequenceValue.isDouble()) {
+        dataPoint.sequence = static_cast<std::uint32_t>(sequenceValue.toDouble());
+    }
+
     return true;
 }
 
@@ -3,9 +3,12 @@
 // Single Responsibility: Backend Communication ONLY
 
 #include "network/WebSocketClient.h"
+#include "constants/Network.h"
+#include <QNetworkRequest>
 #include <QWebSocket>
 #include <QTimer>
 #include <QUrl>
+#include <QUrlQuery>
 #include <QDebug>
 
 namespace siren {
@@ -27,6 +30,9 @@ WebSocketClient::WebSocketClient(QObject* parent)
     , m_reconnectAttempts(0)
     , m_autoReconnect(true)
     , m_state(State::Disconnected)
+    , m_lastSequence(0)
+    , m_hasSequence(false)
+    , m_lostSamples(0)
 {
     // Configure reconnect timer (single-shot)
     m_reconnectTimer->setSingleShot(true);
@@ -38,6 +44,8 @@ WebSocketClient::WebSocketClient(QObject* parent)
             this, &WebSocketClient::onDisconnected);
     connect(m_webSocket.data(), &QWebSocket::textMessageReceived,
             this, &WebSocketClient::onTextMessageReceived);
+    connect(m_webSocket.data(), &QWebSocket::binaryMessageReceived,
+            this, &WebSocketClient::onBinaryMessageReceived);
     connect(m_webSocket.data(), &QWebSocket::errorOccurred,
             this, &WebSocketClient::onError);
 
@@ -56,11 +64,12 @@ void WebSocketClient::connectToServer(const QUrl& url)
     m_serverUrl = url;
     m_state = State::Connecting;
     resetReconnectAttempts();
+    resetSequence();
 
     emit stateChanged(m_state);
 
     // Start connection attempt
-    m_webSocket->open(m_serverUrl);
+    openConnection();
 }
 
 void WebSocketClient::disconnectFromServer()
@@ -105,6 +114,41 @@ void WebSocketClient::sendBinaryMessage(const QByteArray& data)
     }
 }
 
+void WebSocketClient::acknowledgeSequence(std::uint32_t sequence)
+{
+    if (sequence == 0) {
+        return; // Backend without sequence numbers
+    }
+
+    // Serial number arithmetic: the backend counter wraps
+    const auto ahead = static_cast<std::int32_t>(sequence - m_lastSequence);
+    if (m_hasSequence && ahead <= 0) {
+        return; // Snapshot record or duplicate, already past it
+    }
+
+    if (m_hasSequence && ahead > 1) {
+        m_lostSamples += static_cast<std::uint64_t>(ahead - 1);
+        qWarning() << "Sonar samples lost:" << (ahead - 1) << "before seq" << sequence
+                   << "(total" << m_lostSamples << ")";
+    }
+
+    m_lastSequence = sequence;
+    m_hasSequence = true;
+}
+
+void WebSocketClient::resyncSequence(std::uint32_t sequence)
+{
+    if (sequence == 0) {
+        return;
+    }
+
+    // Behind us means the backend restarted; its new stream starts here
+    if (static_cast<std::int32_t>(sequence - m_lastSequence) <= 0) {
+        m_hasSequence = false;
+    }
+    acknowledgeSequence(sequence);
+}
+
 WebSocketClient::State WebSocketClient::state() const
 {
     return m_state;
@@ -144,6 +188,12 @@ void WebSocketClient::onTextMessageReceived(const QString& message)
     emit textMessageReceived(message);
 }
 
+void WebSocketClient::onBinaryMessageReceived(const QByteArray& data)
+{
+    // siren.bin.v2 frames (sonar/environment); decoded by SonarDataParser
+    emit binaryMessageReceived(data);
+}
+
 void WebSocketClient::onError(QAbstractSocket::SocketError error)
 {
     QString errorString;
@@ -204,7 +254,7 @@ void WebSocketClient::attemptReconnect()
     m_state = State::Connecting;
     emit stateChanged(m_state);
 
-    m_webSocket->open(m_serverUrl);
+    openConnection();
 }
 
 void WebSocketClient::resetReconnectAttempts()
@@ -213,6 +263,31 @@ void WebSocketClient::resetReconnectAttempts()
     m_autoReconnect = true;
 }
 
+void WebSocketClient::resetSequence()
+{
+    m_lastSequence = 0;
+    m_hasSequence = false;
+    m_lostSamples = 0;
+}
+
+void WebSocketClient::openConnection()
+{
+    // After a drop, ask for the samples broadcast while we were away
+    QUrl url(m_serverUrl);
+    if (m_hasSequence) {
+        QUrlQuery query(url);
+        query.removeQueryItem(Constants::Network::Resume::LAST_SEQ_PARAMETER);
+        query.addQueryItem(Constants::Network::Resume::LAST_SEQ_PARAMETER, QString::number(m_lastSequence));
+        url.setQuery(query);
+    }
+
+    // Offer the binary subprotocol; a backend without it answers with JSON text frames
+    QNetworkRequest request(url);
+    request.setRawHeader(Constants::Network::BinaryProtocol::SUBPROTOCOL_HEADER,
+                         Constants::Network::BinaryProtocol::SUBPROTOCOL);
+    m_webSocket->open(request);
+}
+
 std::int32_t WebSocketClient::calculateReconnectDelay() const
 {
     // Exponential backoff: delay = base * (multiplier ^ attempts)
@@ -12,7 +12,10 @@
 #include "data/SonarDataParser.h"
 #include "constants/LayoutConstants.h"
 #include "constants/Network.h"
+#include "constants/VisualizationConstants.h"
 #include <QWidget>
+#include <QKeySequence>
+#include <QShortcut>
 #include <QUrl>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -72,6 +75,28 @@ void MainWindow::createPanels()
     // Create sonar visualization widget (SRP: only renders sonar display)
     m_sonarVisualizationWidget = new SonarVisualizationWidget(this);
 
+    // Repaint cap for low-power terminals; F3 toggles the frame time overlay, F4 phosphor persistence
+    if (qEnvironmentVariableIsSet(constants::visualization::TARGET_FPS_ENV)) {
+        m_sonarVisualizationWidget->setTargetFps(
+            qEnvironmentVariableIntValue(constants::visualization::TARGET_FPS_ENV));
+    }
+    QShortcut* overlayShortcut = new QShortcut(
+        QKeySequence(constants::visualization::FRAME_OVERLAY_SHORTCUT), this);
+    connect(overlayShortcut, &QShortcut::activated, this, [this]() {
+        m_sonarVisualizationWidget->setFrameOverlayEnabled(
+            !m_sonarVisualizationWidget->isFrameOverlayEnabled());
+    });
+    if (qEnvironmentVariableIsSet(constants::visualization::PHOSPHOR_HALF_LIFE_ENV)) {
+        m_sonarVisualizationWidget->setPersistenceHalfLife(
+            qEnvironmentVariableIntValue(constants::visualization::PHOSPHOR_HALF_LIFE_ENV));
+    }
+    QShortcut* persistenceShortcut = new QShortcut(
+        QKeySequence(constants::visualization::PERSISTENCE_SHORTCUT), this);
+    connect(persistenceShortcut, &QShortcut::activated, this, [this]() {
+        m_sonarVisualizationWidget->setPersistenceEnabled(
+            !m_sonarVisualizationWidget->isPersistenceEnabled());
+    });
+
     // Create placeholder panels for other components
     QFrame* controlPanel = PanelFactory::createPlaceholder("CONTROL PANEL", this);
     QFrame* sonarPanel = PanelFactory::createPanel(PanelFactory::PanelType::SONAR, this);
@@ -155,6 +180,8 @@ void MainWindow::initializeWebSocketClient()
                     // Successfully parsed sonar data
                     qDebug() << "✅ Sonar data received:" << sonarData.toString();
 
+                    m_webSocketClient->acknowledgeSequence(sonarData.sequence);
+
                     // Update sonar data widget (SRP: only displays data)
                     m_sonarDataWidget->updateSonarData(sonarData);
 
@@ -167,6 +194,57 @@ void MainWindow::initializeWebSocketClient()
                 }
             });
 
+    // Connect to binary sonar frames (siren.bin.v2 subprotocol)
+    connect(m_webSocketClient, &Network::IWebSocketClient::binaryMessageReceived,
+            this, [this](const QByteArray& frame) {
+                data::SonarDataPoint sonarData;
+                const auto parseResult = data::SonarDataParser::parseBinaryFrame(frame, sonarData);
+
+                if (parseResult == data::SonarDataParser::ParseResult::SUCCESS) {
+                    m_webSocketClient->acknowledgeSequence(sonarData.sequence);
+                    m_sonarDataWidget->updateSonarData(sonarData);
+                    m_sonarVisualizationWidget->updateSonarData(sonarData);
+                    return;
+                }
+
+                // Samples missed while reconnecting, in order, before live data resumes
+                QVector<data::SonarDataPoint> points;
+                if (parseResult == data::SonarDataParser::ParseResult::UNKNOWN_MESSAGE &&
+                    data::SonarDataParser::parseBinaryReplay(frame, points) ==
+                        data::SonarDataParser::ParseResult::SUCCESS) {
+                    for (const auto& point : points) {
+                        m_webSocketClient->acknowledgeSequence(point.sequence);
+                        m_sonarVisualizationWidget->updateSonarData(point);
+                    }
+                    if (!points.isEmpty()) {
+                        m_sonarDataWidget->updateSonarData(points.last());
+                    }
+                    return;
+                }
+
+                // Latest scan sent on connect: fill the scope without waiting a full sweep
+                if (parseResult == data::SonarDataParser::ParseResult::UNKNOWN_MESSAGE &&
+                    data::SonarDataParser::parseBinarySnapshot(frame, points) ==
+                        data::SonarDataParser::ParseResult::SUCCESS) {
+                    std::uint32_t newest = 0;
+                    for (const auto& point : points) {
+                        m_sonarVisualizationWidget->updateSonarData(point);
+                        newest = qMax(newest, point.sequence);
+                    }
+                    if (!points.isEmpty()) {
+                        m_sonarDataWidget->updateSonarData(points.last());
+                    }
+                    // Re-sync: anything between our last sample and the snapshot is lost for good
+                    m_webSocketClient->resyncSequence(newest);
+                    return;
+                }
+
+                if (parseResult != data::SonarDataParser::ParseResult::UNKNOWN_MESSAGE) {
+                    const QString errorDesc = data::SonarDataParser::getErrorDescription(parseResult);
+                    qDebug() << "❌ Failed to parse binary sonar frame:" << errorDesc << "Size:" << frame.size();
+                }
+            });
+
     // Connect to backend server automatically
     const QUrl serverUrl(Constants::Network::BACKEND_URL);
     m_webSocketClient->connectToServer(serverUrl);
@@ -6,12 +6,16 @@
 #include "visualization/PolarCoordinateConverter.h"
 #include "visualization/SonarDataBuffer.h"
 #include "visualization/SonarAnimationController.h"
+#include "visualization/FrameScheduler.h"
+#include "visualization/PhosphorLayer.h"
 #include "constants/VisualizationConstants.h"
 #include <QPainter>
 #include <QPen>
 #include <QBrush>
 #include <QFont>
-#include <QDateTime>
+#include <QEvent>
+#include <QTransform>
+#include <algorithm>
 
 namespace siren {
 namespace ui {
@@ -23,9 +27,16 @@ SonarVisualizationWidget::SonarVisualizationWidget(QWidget* parent)
     , m_coordinateConverter(std::make_unique<visualization::PolarCoordinateConverter>())
     , m_dataBuffer(std::make_unique<visualization::SonarDataBuffer>())
     , m_animationController(std::make_unique<visualization::SonarAnimationController>())
+    , m_frameScheduler(std::make_unique<visualization::FrameScheduler>())
+    , m_phosphorLayer(std::make_unique<visualization::PhosphorLayer>())
+    , m_scaleFont(MONOSPACE_FONT, SCALE_FONT_SIZE)
+    , m_screenPoints(m_dataBuffer->capacity())
 {
     initializeComponents();
 
+    // Point timestamps and expiry run on a monotonic clock (wall-clock steps would stall expiry)
+    m_pointClock.start();
+
     // Set minimum size
     setMinimumSize(MIN_WIDGET_SIZE, MIN_WIDGET_SIZE);
 
@@ -40,9 +51,17 @@ SonarVisualizationWidget::~SonarVisualizationWidget() = default;
 
 void SonarVisualizationWidget::initializeComponents()
 {
-    // Connect animation updates to trigger repaints
+    // Sweep movement damages only the wedge between old and new line
+    m_lastSweepAngle = m_animationController->getCurrentAngle();
     connect(m_animationController.get(), &visualization::SonarAnimationController::angleChanged,
-            this, [this](std::uint16_t) { update(); });
+            this, [this](std::uint16_t angle) {
+                m_frameScheduler->invalidate(sweepWedgeRect(m_lastSweepAngle, angle));
+                m_lastSweepAngle = angle;
+            });
+
+    // One repaint per frame, whatever the sample rate
+    connect(m_frameScheduler.get(), &visualization::FrameScheduler::frameDue,
+            this, &SonarVisualizationWidget::onFrameDue);
 
     // DO NOT start automatic animation - only use real servo data
     // m_animationController->start();
@@ -54,22 +73,29 @@ void SonarVisualizationWidget::updateSonarData(const data::SonarDataPoint& sonar
         // CRITICAL: Synchronize cursor with actual servo position
         m_animationController->syncWithServoPosition(sonarData.angle);
 
-        // Add data point with current timestamp
-        const std::uint64_t timestamp = QDateTime::currentMSecsSinceEpoch();
+        // Add data point with current timestamp (a full buffer drops its oldest point)
+        const auto timestamp = static_cast<std::uint64_t>(m_pointClock.elapsed());
+        if (m_dataBuffer->size() == m_dataBuffer->capacity()) {
+            const auto* oldest = m_dataBuffer->getOldest();
+            m_frameScheduler->invalidate(pointRect(oldest->angle, oldest->distance));
+        }
         m_dataBuffer->addPoint(sonarData, timestamp);
+        m_frameScheduler->invalidate(pointRect(sonarData.angle, sonarData.distance));
 
-        // Remove expired points
-        m_dataBuffer->removeExpiredPoints(timestamp, POINT_LIFETIME_MS);
-
-        // Trigger repaint
-        update();
+        // Remove expired points, erasing them on the next frame
+        m_dataBuffer->removeExpiredPoints(timestamp, POINT_LIFETIME_MS,
+            [this](const visualization::SonarDataBuffer::BufferedPoint& point) {
+                m_frameScheduler->invalidate(pointRect(point.angle, point.distance));
+            });
     }
 }
 
 void SonarVisualizationWidget::clearDisplay()
 {
     m_dataBuffer->clear();
-    update();
+    m_phosphorLayer->clear();
+    m_phosphorStamped = m_dataBuffer->getInsertCount();
+    m_frameScheduler->invalidateAll();
 }
 
 void SonarVisualizationWidget::setAnimationEnabled(bool enabled)
@@ -81,23 +107,94 @@ void SonarVisualizationWidget::setAnimationEnabled(bool enabled)
     }
 }
 
-void SonarVisualizationWidget::paintEvent(QPaintEvent* event)
+void SonarVisualizationWidget::setTargetFps(int fps)
 {
-    Q_UNUSED(event)
+    m_frameScheduler->setTargetFps(fps);
+}
 
+void SonarVisualizationWidget::setFrameOverlayEnabled(bool enabled)
+{
+    m_frameOverlayEnabled = enabled;
+    update(frameOverlayRect());
+}
+
+void SonarVisualizationWidget::setPersistenceEnabled(bool enabled)
+{
+    if (enabled == m_persistenceEnabled) {
+        return;
+    }
+
+    m_persistenceEnabled = enabled;
+    if (enabled) {
+        // Start the afterglow from the points already on screen
+        m_phosphorLayer->clear();
+        m_phosphorStamped = 0;
+        m_phosphorClock.start();
+    }
+    m_frameScheduler->invalidateAll();
+}
+
+void SonarVisualizationWidget::setPersistenceHalfLife(double halfLifeMs)
+{
+    m_phosphorLayer->setHalfLife(halfLifeMs);
+}
+
+void SonarVisualizationWidget::onFrameDue(const QRegion& damage, bool fullFrame)
+{
+    // The afterglow fades everywhere at once, so persistence frames are always full
+    if (fullFrame || !m_geometryValid || m_persistenceEnabled) {
+        update();
+        return;
+    }
+
+    // Overlay numbers change every frame that is painted
+    QRegion region = damage;
+    if (m_frameOverlayEnabled) {
+        region += frameOverlayRect();
+    }
+    update(region);
+}
+
+void SonarVisualizationWidget::paintEvent(QPaintEvent* event)
+{
     if (!m_geometryValid) {
         return;
     }
 
+    m_frameScheduler->frameStarted();
+
+    // Moving to a screen with another scale factor also invalidates the cache
+    if (!m_staticLayersValid || m_staticLayer.devicePixelRatio() != devicePixelRatioF()) {
+        rebuildStaticLayers();
+    }
+
     QPainter painter(this);
-    painter.setRenderHint(QPainter::Antialiasing);
 
-    // Draw display components in order
-    drawBackground(painter);
-    drawPolarGrid(painter);
-    drawDataPoints(painter);
+    // Static layers: one blit instead of background, rings and spokes
+    painter.drawPixmap(0, 0, m_staticLayer);
+
+    // Dynamic layers, then labels on top as before (Qt clips all of it to the damage)
+    painter.setRenderHint(QPainter::Antialiasing);
+    if (m_persistenceEnabled) {
+        advancePhosphor();
+        painter.drawImage(0, 0, m_phosphorLayer->image());
+    } else {
+        drawDataPoints(painter, event->rect());
+    }
     drawSweepLine(painter);
     drawScaleLabels(painter);
+
+    if (m_frameOverlayEnabled) {
+        drawFrameOverlay(painter);
+    }
+
+    painter.end();
+
+    // Keep frames coming while anything still glows; a dark layer lets the display idle
+    if (m_persistenceEnabled && !m_phosphorLayer->isDark()) {
+        m_frameScheduler->invalidateAll();
+    }
+    m_frameScheduler->frameFinished();
 }
 
 void SonarVisualizationWidget::resizeEvent(QResizeEvent* event)
@@ -106,6 +203,85 @@ void SonarVisualizationWidget::resizeEvent(QResizeEvent* event)
     updateDisplayGeometry();
 }
 
+void SonarVisualizationWidget::changeEvent(QEvent* event)
+{
+    QWidget::changeEvent(event);
+
+    switch (event->type()) {
+    case QEvent::PaletteChange:
+    case QEvent::StyleChange:
+    case QEvent::FontChange:
+        m_staticLayersValid = false;
+        m_frameScheduler->invalidateAll();
+        break;
+    default:
+        break;
+    }
+}
+
+void SonarVisualizationWidget::rebuildStaticLayers()
+{
+    // Device-pixel sized so the blit is 1:1 on high-DPI displays
+    const qreal pixelRatio = devicePixelRatioF();
+    m_staticLayer = QPixmap(size() * pixelRatio);
+    m_staticLayer.setDevicePixelRatio(pixelRatio);
+
+    QPainter painter(&m_staticLayer);
+    painter.setRenderHint(QPainter::Antialiasing);
+    drawBackground(painter);
+    drawPolarGrid(painter);
+    painter.end();
+
+    // Distance labels along the 90° spoke
+    m_scaleLabels.clear();
+    for (std::uint16_t distance = 100; distance <= DISPLAY_MAX_DISTANCE; distance += 100) {
+        addScaleLabel(QString("%1cm").arg(distance),
+                      m_coordinateConverter->polarToScreen(90, distance));
+    }
+
+    // Angle labels across full display range (0-180°), just above the outer ring
+    for (std::uint16_t angle = 0; angle <= 180; angle += ANGLE_MARKER_INTERVAL) {
+        const QPoint labelPoint = m_coordinateConverter->polarToScreen(angle, DISPLAY_MAX_DISTANCE + 20);
+        addScaleLabel(QString("%1°").arg(angle), QPointF(labelPoint.x(), labelPoint.y() - 10));
+    }
+
+    m_staticLayersValid = true;
+}
+
+void SonarVisualizationWidget::addScaleLabel(const QString& text, const QPointF& center)
+{
+    ScaleLabel label;
+    label.text.setText(text);
+    label.text.setPerformanceHint(QStaticText::AggressiveCaching);
+    label.text.prepare(QTransform(), m_scaleFont);
+
+    const QSizeF textSize = label.text.size();
+    label.topLeft = QPointF(center.x() - textSize.width() / 2.0, center.y() - textSize.height() / 2.0);
+    m_scaleLabels.push_back(label);
+}
+
+QRect SonarVisualizationWidget::pointRect(std::uint16_t angle, std::uint16_t distance) const
+{
+    // Point radius plus one pixel of antialiasing
+    constexpr int extent = DATA_POINT_SIZE + 1;
+    const QPoint center = m_coordinateConverter->polarToScreen(angle, distance);
+    return QRect(center.x() - extent, center.y() - extent, 2 * extent + 1, 2 * extent + 1);
+}
+
+QRect SonarVisualizationWidget::sweepWedgeRect(std::uint16_t fromAngle, std::uint16_t toAngle) const
+{
+    // Both line positions lie inside the box spanned by the centre and their ends
+    const QPoint fromEnd = m_coordinateConverter->polarToScreen(fromAngle, DISPLAY_MAX_DISTANCE);
+    const QPoint toEnd = m_coordinateConverter->polarToScreen(toAngle, DISPLAY_MAX_DISTANCE);
+    const QRect wedge = QRect(m_centerPoint, fromEnd).normalized().united(QRect(m_centerPoint, toEnd).normalized());
+    return wedge.adjusted(-SWEEP_LINE_WIDTH, -SWEEP_LINE_WIDTH, SWEEP_LINE_WIDTH, SWEEP_LINE_WIDTH);
+}
+
+QRect SonarVisualizationWidget::frameOverlayRect() const
+{
+    return QRect(FRAME_OVERLAY_MARGIN, FRAME_OVERLAY_MARGIN, FRAME_OVERLAY_WIDTH, FRAME_OVERLAY_HEIGHT);
+}
+
 void SonarVisualizationWidget::updateDisplayGeometry()
 {
     // Calculate display center and radius
@@ -126,6 +302,10 @@ void SonarVisualizationWidget::updateDisplayGeometry()
     m_coordinateConverter->setMaxDistance(DISPLAY_MAX_DISTANCE);
 
     m_geometryValid = true;
+    m_staticLayersValid = false;
+
+    // The phosphor layer is reallocated at the new size: restamp what is buffered
+    m_phosphorStamped = 0;
 }
 
 void SonarVisualizationWidget::drawBackground(QPainter& painter) const
@@ -189,53 +369,53 @@ void SonarVisualizationWidget::drawAngleLines(QPainter& painter) const
 
 void SonarVisualizationWidget::drawScaleLabels(QPainter& painter) const
 {
+    // Text laid out once per geometry; drawStaticText reuses the glyph layout
     painter.setPen(QColor(colors::SCALE_TEXT));
-    QFont font(MONOSPACE_FONT, SCALE_FONT_SIZE);
-    painter.setFont(font);
-
-    // Draw distance labels
-    for (std::uint16_t distance = 100; distance <= DISPLAY_MAX_DISTANCE; distance += 100) {
-        const QPoint labelPoint = m_coordinateConverter->polarToScreen(90, distance);
-        const QString label = QString("%1cm").arg(distance);
-
-        const QRect textRect(labelPoint.x() - 30, labelPoint.y() - 10, 60, 20);
-        painter.drawText(textRect, Qt::AlignCenter, label);
-    }
-
-    // Draw angle labels across full display range (0-180°)
-    for (std::uint16_t angle = 0; angle <= 180; angle += ANGLE_MARKER_INTERVAL) {
-        const QPoint labelPoint = m_coordinateConverter->polarToScreen(angle, DISPLAY_MAX_DISTANCE + 20);
-        const QString label = QString("%1°").arg(angle);
+    painter.setFont(m_scaleFont);
 
-        const QRect textRect(labelPoint.x() - 20, labelPoint.y() - 20, 40, 20);
-        painter.drawText(textRect, Qt::AlignCenter, label);
+    for (const ScaleLabel& label : m_scaleLabels) {
+        painter.drawStaticText(label.topLeft, label.text);
     }
 }
 
-void SonarVisualizationWidget::drawDataPoints(QPainter& painter) const
+void SonarVisualizationWidget::drawDataPoints(QPainter& painter, const QRect& clip) const
 {
-    const std::uint64_t currentTime = QDateTime::currentMSecsSinceEpoch();
-    const auto& points = m_dataBuffer->getPoints();
-
-    for (const auto& point : points) {
-        if (!point.valid) continue;
-
-        // Skip fade calculation - display all valid points without fading
-        // Remove any trailing shadow effects by displaying points at full opacity
-
-        // Convert to screen coordinates
-        const QPoint screenPoint = m_coordinateConverter->polarToScreen(point.angle, point.distance);
+    // Points whose disc cannot touch the repainted area are skipped
+    constexpr int extent = DATA_POINT_SIZE + 1;
+    const QRectF cullRect = clip.adjusted(-extent, -extent, extent, extent);
+
+    // Whole buffer -> screen coordinates through the trig tables, no per-point state changes
+    std::size_t count = 0;
+    for (const auto& segment : m_dataBuffer->getSegments()) {
+        count += m_coordinateConverter->polarToScreen(segment, cullRect, m_screenPoints.data() + count);
+    }
+    if (count == 0) {
+        return;
+    }
 
-        // Use solid color without any fading effects
-        QColor pointColor(colors::DATA_POINT_RECENT);
-        // Completely remove alpha effects to eliminate shadow trails
-        pointColor.setAlpha(255);
+    // A round-capped pen of the point diameter draws each point as a solid disc
+    // (full opacity, no fade - no trailing shadow effects)
+    QPen pointPen(QColor(colors::DATA_POINT_RECENT));
+    pointPen.setWidth(2 * DATA_POINT_SIZE);
+    pointPen.setCapStyle(Qt::RoundCap);
+    painter.setPen(pointPen);
+    painter.drawPoints(m_screenPoints.data(), static_cast<int>(count));
+}
 
-        // Draw point
-        painter.setPen(Qt::NoPen);
-        painter.setBrush(pointColor);
-        painter.drawEllipse(screenPoint, DATA_POINT_SIZE, DATA_POINT_SIZE);
+void SonarVisualizationWidget::advancePhosphor()
+{
+    // Reallocates (and clears) only when the widget size or screen scale changed
+    m_phosphorLayer->resize(size(), devicePixelRatioF());
+    m_phosphorLayer->decay(static_cast<double>(m_phosphorClock.restart()));
+
+    // Only the points added since the last frame: history lives in the image
+    std::size_t count = 0;
+    for (const auto& segment : m_dataBuffer->getSegmentsSince(m_phosphorStamped)) {
+        count += m_coordinateConverter->polarToScreen(segment, m_screenPoints.data() + count);
     }
+    m_phosphorStamped = m_dataBuffer->getInsertCount();
+
+    m_phosphorLayer->stamp(m_screenPoints.data(), count, QColor(colors::DATA_POINT_RECENT), DATA_POINT_SIZE);
 }
 
 void SonarVisualizationWidget::drawSweepLine(QPainter& painter) const
@@ -261,5 +441,17 @@ void SonarVisualizationWidget::drawTitle(QPainter& painter) const
     painter.drawText(titleRect, Qt::AlignCenter, title);
 }
 
+void SonarVisualizationWidget::drawFrameOverlay(QPainter& painter) const
+{
+    painter.setPen(QColor(colors::OVERLAY_TEXT));
+    painter.setFont(m_scaleFont);
+
+    const QString stats = QString("%1 fps  %2 ms/frame  cap %3")
+        .arg(m_frameScheduler->getFps(), 0, 'f', 1)
+        .arg(m_frameScheduler->getFrameTimeMs(), 0, 'f', 2)
+        .arg(m_frameScheduler->getTargetFps());
+    painter.drawText(frameOverlayRect(), Qt::AlignLeft | Qt::AlignVCenter, stats);
+}
+
 } // namespace ui
 } // namespace siren
\ No newline at end of file
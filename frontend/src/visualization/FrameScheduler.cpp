@@ -0,0 +1,106 @@
+// SIREN Sonar System
+// Frame Scheduler Implementation
+// Single Responsibility: Repaint Pacing ONLY
+
+#include "visualization/FrameScheduler.h"
+#include "constants/VisualizationConstants.h"
+#include <algorithm>
+
+namespace siren {
+namespace visualization {
+
+using namespace constants::visualization;
+
+namespace {
+    constexpr std::int64_t NANOSECONDS_PER_SECOND = 1000000000;
+    constexpr std::int64_t NANOSECONDS_PER_MILLISECOND = 1000000;
+}
+
+FrameScheduler::FrameScheduler(QObject* parent)
+    : QObject(parent)
+    , m_frameTimer(new QTimer(this))
+{
+    // One-shot: armed only while something is dirty, so an idle display costs nothing
+    m_frameTimer->setSingleShot(true);
+    m_frameTimer->setTimerType(Qt::PreciseTimer);
+    connect(m_frameTimer, &QTimer::timeout, this, &FrameScheduler::onFrameTimer);
+
+    m_clock.start();
+    setTargetFps(DEFAULT_TARGET_FPS);
+}
+
+void FrameScheduler::setTargetFps(int fps)
+{
+    m_targetFps = std::clamp(fps, MIN_TARGET_FPS, MAX_TARGET_FPS);
+    m_frameIntervalNs = NANOSECONDS_PER_SECOND / m_targetFps;
+}
+
+void FrameScheduler::invalidate(const QRect& rect)
+{
+    if (!m_fullFrame) {
+        m_damage += rect;
+
+        // Many scattered rects cost more to clip than one full repaint
+        if (m_damage.rectCount() > MAX_DAMAGE_RECTS) {
+            m_fullFrame = true;
+            m_damage = QRegion();
+        }
+    }
+    scheduleFrame();
+}
+
+void FrameScheduler::invalidateAll()
+{
+    m_fullFrame = true;
+    m_damage = QRegion();
+    scheduleFrame();
+}
+
+void FrameScheduler::scheduleFrame()
+{
+    if (m_frameTimer->isActive()) {
+        return;  // Already coalescing into the next frame
+    }
+
+    const std::int64_t nextFrameNs = m_lastFrameNs + m_frameIntervalNs;
+    const std::int64_t waitNs = std::max<std::int64_t>(0, nextFrameNs - m_clock.nsecsElapsed());
+    m_frameTimer->start(static_cast<int>(waitNs / NANOSECONDS_PER_MILLISECOND));
+}
+
+void FrameScheduler::onFrameTimer()
+{
+    m_lastFrameNs = m_clock.nsecsElapsed();
+
+    const QRegion damage = m_damage;
+    const bool fullFrame = m_fullFrame;
+    m_damage = QRegion();
+    m_fullFrame = false;
+
+    emit frameDue(damage, fullFrame);
+}
+
+void FrameScheduler::frameStarted()
+{
+    m_paintStartNs = m_clock.nsecsElapsed();
+}
+
+void FrameScheduler::frameFinished()
+{
+    const std::int64_t nowNs = m_clock.nsecsElapsed();
+    const double paintMs = static_cast<double>(nowNs - m_paintStartNs) /
+                           static_cast<double>(NANOSECONDS_PER_MILLISECOND);
+    m_frameTimeMs += FRAME_TIME_SMOOTHING * (paintMs - m_frameTimeMs);
+
+    // Presented frames over a fixed window
+    ++m_framesInWindow;
+    const std::int64_t windowNs = nowNs - m_windowStartNs;
+    if (windowNs >= FPS_WINDOW_MS * NANOSECONDS_PER_MILLISECOND) {
+        m_fps = static_cast<double>(m_framesInWindow) * static_cast<double>(NANOSECONDS_PER_SECOND) /
+                static_cast<double>(windowNs);
+        m_framesInWindow = 0;
+        m_windowStartNs = nowNs;
+    }
+}
+
+} // namespace visualization
+} // namespace siren
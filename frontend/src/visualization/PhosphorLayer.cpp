@@ -0,0 +1,139 @@
+// SIREN Sonar System
+// Phosphor Layer Implementation
+// Single Responsibility: Persistence Image Accumulation ONLY
+
+#include "visualization/PhosphorLayer.h"
+#include "constants/VisualizationConstants.h"
+#include <QPainter>
+#include <QPen>
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace siren {
+namespace visualization {
+
+using namespace constants::visualization;
+
+namespace {
+    constexpr std::uint32_t FIXED_POINT_ONE = 256;        // Decay factors in 1/256 steps
+    constexpr std::uint32_t FIXED_POINT_SHIFT = 8;
+    constexpr std::uint32_t MAX_DECAY_SCALE = FIXED_POINT_ONE - 1;  // Always fades by at least one step
+    constexpr std::uint32_t MAX_CHANNEL = 255;
+    constexpr std::uint32_t EVEN_CHANNELS = 0x00FF00FFu;  // Blue and red of 0xAARRGGBB
+    constexpr std::uint32_t ODD_CHANNELS = 0xFF00FF00u;   // Green and alpha of 0xAARRGGBB
+#if defined(__SSE2__)
+    constexpr std::size_t SSE2_PIXELS = 4;                // Pixels per 128-bit register
+#endif
+}
+
+PhosphorLayer::PhosphorLayer()
+    : m_halfLifeMs(PHOSPHOR_HALF_LIFE_MS)
+{
+}
+
+void PhosphorLayer::resize(const QSize& size, qreal devicePixelRatio)
+{
+    const QSize pixelSize = size * devicePixelRatio;
+    if (!m_image.isNull() && m_image.size() == pixelSize && m_image.devicePixelRatio() == devicePixelRatio) {
+        return;
+    }
+
+    // Premultiplied: scaling all four channels alike fades the color toward transparent
+    m_image = QImage(pixelSize, QImage::Format_ARGB32_Premultiplied);
+    m_image.setDevicePixelRatio(devicePixelRatio);
+    clear();
+}
+
+void PhosphorLayer::decay(double elapsedMs)
+{
+    if (m_peak == 0) {
+        m_pendingMs = 0.0;
+        return;
+    }
+
+    // Fade in steps of at least PHOSPHOR_DECAY_STEP_MS so the 8-bit factor tracks the
+    // half-life at high frame rates instead of rounding every frame
+    m_pendingMs += std::max(0.0, elapsedMs);
+    if (m_pendingMs < PHOSPHOR_DECAY_STEP_MS) {
+        return;
+    }
+
+    const double factor = std::exp2(-m_pendingMs / m_halfLifeMs);
+    const auto scale = static_cast<std::uint32_t>(
+        std::min<long>(std::lround(factor * FIXED_POINT_ONE), MAX_DECAY_SCALE));
+    m_pendingMs = 0.0;
+
+    scalePixels(scale);
+    m_peak = (m_peak * scale) >> FIXED_POINT_SHIFT;
+}
+
+void PhosphorLayer::stamp(const QPointF* points, std::size_t count, const QColor& color, int radius)
+{
+    if (count == 0 || m_image.isNull()) {
+        return;
+    }
+
+    // Same round-capped disc as the direct renderer, at full brightness over the afterglow
+    QPen pointPen(color);
+    pointPen.setWidth(2 * radius);
+    pointPen.setCapStyle(Qt::RoundCap);
+
+    QPainter painter(&m_image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(pointPen);
+    painter.drawPoints(points, static_cast<int>(count));
+    painter.end();
+
+    m_peak = MAX_CHANNEL;
+}
+
+void PhosphorLayer::clear()
+{
+    m_image.fill(Qt::transparent);
+    m_peak = 0;
+    m_pendingMs = 0.0;
+}
+
+void PhosphorLayer::setHalfLife(double halfLifeMs)
+{
+    m_halfLifeMs = std::clamp(halfLifeMs, MIN_PHOSPHOR_HALF_LIFE_MS, MAX_PHOSPHOR_HALF_LIFE_MS);
+}
+
+void PhosphorLayer::scalePixels(std::uint32_t scale)
+{
+    // Whole image as one flat run: 32-bit scanlines are padding-free
+    auto* pixels = reinterpret_cast<std::uint32_t*>(m_image.bits());
+    const std::size_t pixelCount = static_cast<std::size_t>(m_image.sizeInBytes()) / sizeof(std::uint32_t);
+
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    // Four pixels per step: widen channels to 16 bits, multiply, shift, narrow back
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i factor = _mm_set1_epi16(static_cast<short>(scale));
+    for (; i + SSE2_PIXELS <= pixelCount; i += SSE2_PIXELS) {
+        auto* block = reinterpret_cast<__m128i*>(pixels + i);
+        const __m128i packed = _mm_loadu_si128(block);
+        const __m128i low = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(packed, zero), factor), FIXED_POINT_SHIFT);
+        const __m128i high = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(packed, zero), factor), FIXED_POINT_SHIFT);
+        _mm_storeu_si128(block, _mm_packus_epi16(low, high));
+    }
+#endif
+
+    // Remainder, and other targets: two channels per multiply (SWAR). Each 8-bit channel
+    // times scale <= 255 * 255 fits in its 16-bit lane. GCC at -O2 keeps this scalar,
+    // which is why x86 takes the explicit SSE2 path above.
+    for (; i < pixelCount; ++i) {
+        const std::uint32_t pixel = pixels[i];
+        const std::uint32_t even = (((pixel & EVEN_CHANNELS) * scale) >> FIXED_POINT_SHIFT) & EVEN_CHANNELS;
+        const std::uint32_t odd = (((pixel >> FIXED_POINT_SHIFT) & EVEN_CHANNELS) * scale) & ODD_CHANNELS;
+        pixels[i] = even | odd;
+    }
+}
+
+} // namespace visualization
+} // namespace siren
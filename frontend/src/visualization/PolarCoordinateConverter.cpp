@@ -8,6 +8,11 @@
 namespace siren {
 namespace visualization {
 
+PolarCoordinateConverter::PolarCoordinateConverter()
+{
+    rebuildTables();
+}
+
 void PolarCoordinateConverter::setCenterPoint(const QPoint& center)
 {
     m_center = center;
@@ -16,15 +21,34 @@ void PolarCoordinateConverter::setCenterPoint(const QPoint& center)
 void PolarCoordinateConverter::setDisplayRadius(int radius)
 {
     m_displayRadius = std::max(1, radius);  // Ensure positive radius
+    rebuildTables();
 }
 
 void PolarCoordinateConverter::setMaxDistance(std::uint16_t maxDistance)
 {
     m_maxDistance = std::max(std::uint16_t(1), maxDistance);  // Ensure positive distance
+    rebuildTables();
+}
+
+void PolarCoordinateConverter::rebuildTables()
+{
+    const double scaleFactor = static_cast<double>(m_displayRadius) / static_cast<double>(m_maxDistance);
+    for (std::size_t angle = 0; angle < ANGLE_TABLE_SIZE; ++angle) {
+        const double radians = degreesToRadians(static_cast<std::uint16_t>(angle));
+        m_scaledCos[angle] = scaleFactor * std::cos(radians);
+        m_scaledSin[angle] = scaleFactor * std::sin(radians);
+    }
 }
 
 QPoint PolarCoordinateConverter::polarToScreen(std::uint16_t angle, std::uint16_t distance) const
 {
+    // Whole degrees on the display come straight from the tables
+    if (angle < ANGLE_TABLE_SIZE) {
+        const double d = static_cast<double>(distance);
+        return QPoint(m_center.x() + static_cast<int>(d * m_scaledCos[angle]),
+                      m_center.y() - static_cast<int>(d * m_scaledSin[angle]));
+    }
+
     // Scale distance to display radius
     const double scaleFactor = static_cast<double>(m_displayRadius) / static_cast<double>(m_maxDistance);
     const double scaledDistance = static_cast<double>(distance) * scaleFactor;
@@ -41,6 +65,54 @@ QPoint PolarCoordinateConverter::polarToScreen(std::uint16_t angle, std::uint16_
     return QPoint(x, y);
 }
 
+std::size_t PolarCoordinateConverter::polarToScreen(const SonarDataBuffer::Segment& segment,
+                                                 QPointF* output) const
+{
+    const double centerX = static_cast<double>(m_center.x());
+    const double centerY = static_cast<double>(m_center.y());
+
+    // Branch-free body: every slot is written, the count only advances for kept points
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < segment.size; ++i) {
+        const SonarDataBuffer::BufferedPoint& point = segment.data[i];
+        const bool inTable = point.angle < ANGLE_TABLE_SIZE;
+        const std::size_t angle = inTable ? point.angle : 0;
+        const double d = static_cast<double>(point.distance);
+
+        output[written] = QPointF(centerX + d * m_scaledCos[angle], centerY - d * m_scaledSin[angle]);
+        written += static_cast<std::size_t>(point.valid && inTable);
+    }
+    return written;
+}
+
+std::size_t PolarCoordinateConverter::polarToScreen(const SonarDataBuffer::Segment& segment,
+                                                 const QRectF& clip,
+                                                 QPointF* output) const
+{
+    const double centerX = static_cast<double>(m_center.x());
+    const double centerY = static_cast<double>(m_center.y());
+    const double left = clip.left();
+    const double right = clip.right();
+    const double top = clip.top();
+    const double bottom = clip.bottom();
+
+    // Same branch-free body; the clip test only folds into the keep flag
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < segment.size; ++i) {
+        const SonarDataBuffer::BufferedPoint& point = segment.data[i];
+        const bool inTable = point.angle < ANGLE_TABLE_SIZE;
+        const std::size_t angle = inTable ? point.angle : 0;
+        const double d = static_cast<double>(point.distance);
+        const double x = centerX + d * m_scaledCos[angle];
+        const double y = centerY - d * m_scaledSin[angle];
+
+        output[written] = QPointF(x, y);
+        const bool inClip = (x >= left) & (x <= right) & (y >= top) & (y <= bottom);
+        written += static_cast<std::size_t>(point.valid && inTable && inClip);
+    }
+    return written;
+}
+
 bool PolarCoordinateConverter::screenToPolar(const QPoint& point,
                                             std::uint16_t& angle,
                                             std::uint16_t& distance) const
@@ -41,42 +41,66 @@ double SonarDataBuffer::BufferedPoint::getDecayFactor(std::uint64_t currentTime,
 }
 
 SonarDataBuffer::SonarDataBuffer(std::size_t capacity)
-    : m_capacity(capacity)
+    : m_points(std::max<std::size_t>(capacity, 1))
+    , m_nextSameAngle(std::max<std::size_t>(capacity, 1), NO_POINT)
+    , m_capacity(std::max<std::size_t>(capacity, 1))
     , m_pointLifetimeMs(DEFAULT_LIFETIME_MS)
     , m_fadeStartMs(DEFAULT_FADE_START_MS)
 {
-    m_points.reserve(capacity);
 }
 
 void SonarDataBuffer::addPoint(const data::SonarDataPoint& dataPoint, std::uint64_t timestamp)
 {
-    // Check if buffer is full
-    if (m_points.size() >= m_capacity) {
-        // Remove oldest point (FIFO)
-        m_points.erase(m_points.begin());
+    // Full: overwrite the oldest slot (FIFO)
+    if (m_count == m_capacity) {
+        evictOldest();
     }
 
-    // Create buffered point
-    BufferedPoint point;
+    const std::uint64_t index = m_oldest + m_count;
+    const std::size_t slot = slotOf(index);
+
+    BufferedPoint& point = m_points[slot];
     point.angle = dataPoint.angle;
     point.distance = dataPoint.distance;
     point.timestamp = timestamp;
     point.valid = dataPoint.valid;
-
-    // Add to buffer
-    m_points.push_back(point);
+    m_nextSameAngle[slot] = NO_POINT;
+    ++m_count;
+
+    // Append to the angle's chain
+    if (point.angle < ANGLE_BIN_COUNT) {
+        AngleChain& chain = m_angleChains[point.angle];
+        if (chain.newest == NO_POINT) {
+            chain.oldest = index;
+        } else {
+            m_nextSameAngle[slotOf(chain.newest)] = index;
+        }
+        chain.newest = index;
+    }
 }
 
 void SonarDataBuffer::removeExpiredPoints(std::uint64_t currentTime, std::uint64_t lifetimeMs)
 {
-    // Remove all expired points
-    m_points.erase(
-        std::remove_if(m_points.begin(), m_points.end(),
-            [currentTime, lifetimeMs](const BufferedPoint& point) {
-                return point.isExpired(currentTime, lifetimeMs);
-            }),
-        m_points.end()
-    );
+    // Time-ordered ring: everything expired is at the head
+    removeExpiredPoints(currentTime, lifetimeMs, [](const BufferedPoint&) {});
+}
+
+std::array<SonarDataBuffer::Segment, 2> SonarDataBuffer::getSegments() const
+{
+    return getSegmentsSince(m_oldest);
+}
+
+std::array<SonarDataBuffer::Segment, 2> SonarDataBuffer::getSegmentsSince(std::uint64_t index) const
+{
+    const std::uint64_t first = std::max(index, m_oldest);
+    const std::size_t count = (first < getInsertCount()) ? static_cast<std::size_t>(getInsertCount() - first) : 0;
+
+    const std::size_t head = slotOf(first);
+    const std::size_t firstSize = std::min(count, m_capacity - head);
+    return {{
+        Segment{m_points.data() + head, firstSize},
+        Segment{m_points.data(), count - firstSize},
+    }};
 }
 
 void SonarDataBuffer::getPointsInAngleRange(std::uint16_t minAngle,
@@ -84,18 +108,51 @@ void SonarDataBuffer::getPointsInAngleRange(std::uint16_t minAngle,
                                            std::vector<BufferedPoint>& output) const
 {
     output.clear();
-    output.reserve(m_points.size());
 
-    // Copy points within angle range
-    std::copy_if(m_points.begin(), m_points.end(), std::back_inserter(output),
-        [minAngle, maxAngle](const BufferedPoint& point) {
-            return point.valid && point.angle >= minAngle && point.angle <= maxAngle;
-        });
+    // Walk only the chains of the requested angles
+    const std::size_t lastAngle = std::min<std::size_t>(maxAngle, ANGLE_BIN_COUNT - 1);
+    for (std::size_t angle = minAngle; angle <= lastAngle; ++angle) {
+        for (std::uint64_t index = m_angleChains[angle].oldest; index != NO_POINT;
+             index = m_nextSameAngle[slotOf(index)]) {
+            const BufferedPoint& point = m_points[slotOf(index)];
+            if (point.valid) {
+                output.push_back(point);
+            }
+        }
+    }
+}
+
+const SonarDataBuffer::BufferedPoint* SonarDataBuffer::getLatestAtAngle(std::uint16_t angle) const
+{
+    if (angle >= ANGLE_BIN_COUNT || m_angleChains[angle].newest == NO_POINT) {
+        return nullptr;
+    }
+    return &m_points[slotOf(m_angleChains[angle].newest)];
 }
 
 void SonarDataBuffer::clear()
 {
-    m_points.clear();
+    m_oldest += m_count;
+    m_count = 0;
+    m_angleChains.fill(AngleChain{});
+}
+
+void SonarDataBuffer::evictOldest()
+{
+    const std::size_t slot = slotOf(m_oldest);
+    const std::uint16_t angle = m_points[slot].angle;
+
+    // FIFO overall means FIFO per angle: the evicted point heads its chain
+    if (angle < ANGLE_BIN_COUNT) {
+        AngleChain& chain = m_angleChains[angle];
+        chain.oldest = m_nextSameAngle[slot];
+        if (chain.oldest == NO_POINT) {
+            chain.newest = NO_POINT;
+        }
+    }
+
+    ++m_oldest;
+    --m_count;
 }
 
 void SonarDataBuffer::setPointLifetime(std::uint64_t lifetimeMs)